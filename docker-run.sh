@@ -1,22 +1,40 @@
 #!/bin/bash
 
+# Usage: ./docker-run.sh [TAG] [--skip-build]
+# TAG identifies the image contents (the client passes a hash of the server sources), so an image
+# that is already built for it can be reused with --skip-build.
+TAG="${1:-latest}"
+IMAGE="leaf-grpc-server:$TAG"
+
 # Clean up any existing container
 docker rm -f leaf-grpc-server 2>/dev/null || true
 
-# Build Docker image (files are already here)
-echo "Building Docker image..."
-docker build -t leaf-grpc-server . 2>&1
+if [ "$2" != "--skip-build" ]; then
+    # Build Docker image (files are already here)
+    echo "Building Docker image $IMAGE..."
+    docker build -t "$IMAGE" . 2>&1
 
-# Check if build was successful
-if [ $? -ne 0 ]; then
-    echo "Docker build failed!"
-    exit 1
+    # Check if build was successful
+    if [ $? -ne 0 ]; then
+        echo "Docker build failed!"
+        exit 1
+    fi
+
+    # Drop images built from older sources
+    docker images leaf-grpc-server --format '{{.Tag}}' | grep -vx "$TAG" | \
+        xargs -r -I{} docker rmi "leaf-grpc-server:{}" >/dev/null 2>&1 || true
+
+    echo "Docker build successful, starting container..."
+else
+    echo "Reusing Docker image $IMAGE, starting container..."
 fi
 
-echo "Docker build successful, starting container..."
+# Stored models are checkpointed on the host so a restarted container serves them again without re-upload
+CHECKPOINT_DIR="$HOME/.leaf/checkpoints"
+mkdir -p "$CHECKPOINT_DIR"
 
 # Run Docker container (only bind to localhost for SSH tunneling)
-docker run -d -p 127.0.0.1:50051:50051 --name leaf-grpc-server leaf-grpc-server 2>&1
+docker run -d --restart unless-stopped -p 127.0.0.1:50051:50051 -v "$CHECKPOINT_DIR:/checkpoints" --name leaf-grpc-server "$IMAGE" 2>&1
 
 # Check if container started successfully
 if [ $? -ne 0 ]; then
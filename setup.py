@@ -42,6 +42,38 @@ class get_pybind_include(object):
         import pybind11
         return pybind11.get_include(self.user)
 
+def generate_grpc_sources():
+    """Generate the protobuf/gRPC sources from src/server_communication.proto.
+    They are not checked in, since the generated code must match the installed
+    protobuf and gRPC runtime, so building leaf needs protoc and grpc_cpp_plugin.
+    Sources left by an earlier build are reused unless the proto is newer or
+    LEAF_REGENERATE_PROTO=1 is set.
+    """
+    import shutil
+    import subprocess
+    proto = 'src/server_communication.proto'
+    generated = ['src/server_communication.pb.cc', 'src/server_communication.pb.h',
+                 'src/server_communication.grpc.pb.cc', 'src/server_communication.grpc.pb.h']
+    up_to_date = all(os.path.exists(path) and os.path.getmtime(path) >= os.path.getmtime(proto)
+                     for path in generated)
+    if up_to_date and not os.environ.get('LEAF_REGENERATE_PROTO'):
+        return
+    protoc = os.environ.get('PROTOC') or shutil.which('protoc')
+    plugin = os.environ.get('GRPC_CPP_PLUGIN') or shutil.which('grpc_cpp_plugin')
+    if not plugin and os.environ.get('GRPC_HOME'):
+        plugin = os.path.join(os.environ['GRPC_HOME'], 'bin', 'grpc_cpp_plugin')
+    if not protoc or not plugin:
+        raise RuntimeError('protoc and grpc_cpp_plugin are required to build leaf; they generate the '
+                           'sources of ' + proto + ' (set PROTOC / GRPC_CPP_PLUGIN if they are not on PATH)')
+    subprocess.check_call([
+        protoc,
+        '-Isrc',
+        '--cpp_out=src',
+        '--grpc_out=src',
+        '--plugin=protoc-gen-grpc=' + plugin,
+        proto,
+    ])
+
 class BuildExt(build_ext):
     """A custom build extension for adding compiler-specific options."""
     c_opts = {
@@ -59,6 +91,7 @@ class BuildExt(build_ext):
         l_opts['unix'] += darwin_opts
 
     def build_extensions(self):
+        generate_grpc_sources()
         ct = self.compiler.compiler_type
         opts = self.c_opts.get(ct, [])
         link_opts = self.l_opts.get(ct, [])
@@ -89,9 +122,26 @@ ext_modules = [
             'src/model.cpp',
             'src/distributed_model.cpp',
             'src/criterion.cpp',
+            'src/tensor_buffer.cpp',
             'src/user_credentials.cpp',
             'src/server.cpp',
             'src/server_communication.cpp',
+            'src/forward_batcher.cpp',
+            'src/output_cache.cpp',
+            'src/model_store.cpp',
+            'src/mapped_file.cpp',
+            'src/checkpoint.cpp',
+            'src/checkpoint_writer.cpp',
+            'src/resource_probe.cpp',
+            'src/numa_placement.cpp',
+            'src/server_load.cpp',
+            'src/metrics.cpp',
+            'src/logging.cpp',
+            'src/trace.cpp',
+            'src/parameter_server.cpp',
+            'src/flat_optimizer.cpp',
+            'src/local_training.cpp',
+            'src/heartbeat_monitor.cpp',
             'src/server_communication.pb.cc',
             'src/server_communication.grpc.pb.cc'
         ],
@@ -0,0 +1,411 @@
+// Transport overhead of the server's RPCs, apart from model compute: the service runs in this
+// process on an ephemeral loopback port, ForwardPass goes to an identity module, GetGradients is
+// the server's stub and StoreModelWeights overwrites the weights of a model of payload size. Each
+// combination of RPC, payload size, concurrency and codec runs for a fixed time and reports
+// p50/p99/p999 latency and throughput. The stub computes no gradients and answers with a fixed
+// reply, so "gradients" results are marked transport-only: they are not backward-pass timings.
+//
+//   make leaf_bench_rpc && ./leaf_bench_rpc --payload-bytes 4096,1048576 --concurrency 1,8
+//
+// Results are printed and written as JSON to leaf_bench_rpc.json (override with --json PATH).
+
+#include <grpcpp/grpcpp.h>
+#include <pybind11/embed.h>
+#include "server_communication.h"
+#include "metrics.h"
+#include "logging.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace {
+
+// Forward inputs are rows of 1KB samples, as in leaf_bench_serialize
+constexpr size_t sample_elems = 256;
+const char* forward_model_id = "model_0";
+
+struct BenchOptions {
+    std::vector<std::string> rpcs = {"forward", "gradients", "store"};
+    std::vector<size_t> payload_bytes = {4096, 65536, 1048576, 16777216};
+    std::vector<size_t> concurrency = {1, 8};
+    std::vector<std::string> codecs = {"none"};
+    double duration_s = 5.0;
+    size_t warmup_requests = 20;  // Per client thread, before every run
+    BatchingOptions batching;
+    std::string json_path = "leaf_bench_rpc.json";
+};
+
+struct RunResult {
+    std::string rpc;
+    size_t payload_bytes = 0;
+    size_t concurrency = 0;
+    std::string codec;
+    uint64_t requests = 0;
+    uint64_t failures = 0;
+    double seconds = 0;
+    HistogramSummary latency_us;
+};
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+std::vector<size_t> split_sizes(const std::string& list) {
+    std::vector<size_t> sizes;
+    for (const auto& item : split(list)) {
+        sizes.push_back(std::stoull(item));
+    }
+    return sizes;
+}
+
+// GetGradients runs no backward pass yet, so its runs time the request alone
+bool transport_only(const std::string& rpc) {
+    return rpc == "gradients";
+}
+
+grpc_compression_algorithm parse_codec(const std::string& codec) {
+    if (codec == "none") return GRPC_COMPRESS_NONE;
+    if (codec == "deflate") return GRPC_COMPRESS_DEFLATE;
+    if (codec == "gzip") return GRPC_COMPRESS_GZIP;
+    throw std::invalid_argument("Unknown codec '" + codec + "' (expected none, deflate or gzip)");
+}
+
+void print_usage(const char* program) {
+    std::cout << "Usage: " << program << " [--rpc LIST] [--payload-bytes LIST] [--concurrency LIST]"
+              << " [--codec LIST] [--duration-s S] [--warmup N] [--max-batch-size N]"
+              << " [--max-batch-delay-us N] [--json PATH]" << std::endl;
+    std::cout << "  --rpc takes forward, gradients and store; --codec takes none, deflate and gzip." << std::endl;
+    std::cout << "  gradients calls the server's GetGradients stub, which computes nothing, so it" << std::endl;
+    std::cout << "  measures transport only." << std::endl;
+    std::cout << "  Lists are comma separated; every combination is run. Payloads are limited to the" << std::endl;
+    std::cout << "  server's 100MB message size." << std::endl;
+}
+
+// Payload of `bytes` float32 weights, drawn like freshly initialized weights so codecs see
+// realistic (poorly compressible) data
+std::vector<float> make_payload(size_t bytes) {
+    std::vector<float> values(bytes / sizeof(float));
+    std::mt19937 generator(42);
+    std::normal_distribution<float> distribution(0.0f, 0.02f);
+    for (auto& value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+// torch.save() of a module: an identity for ForwardPass, or one holding `numel` weights for
+// StoreModelWeights to overwrite. Caller holds the GIL.
+std::string module_definition(size_t numel) {
+    py::dict scope;
+    scope["numel"] = numel;
+    py::exec(R"(
+import io
+import torch
+if numel == 0:
+    module = torch.nn.Identity()
+else:
+    module = torch.nn.Module()
+    module.register_parameter("weight", torch.nn.Parameter(torch.zeros(numel)))
+buffer = io.BytesIO()
+torch.save(module, buffer)
+definition = buffer.getvalue()
+)", scope);
+    return scope["definition"].cast<std::string>();
+}
+
+std::string store_model_id(size_t payload_bytes) {
+    return "bench_store_" + std::to_string(payload_bytes);
+}
+
+class RpcBench {
+private:
+    const BenchOptions& options;
+    std::shared_ptr<grpc::Channel> channel;
+    std::vector<float> payload;
+
+    // Issue one call of the given RPC; returns whether it succeeded
+    bool call(leaftest::ServerCommunication::Stub& stub, const std::string& rpc, size_t payload_bytes,
+              grpc_compression_algorithm codec) {
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(60));
+        context.set_compression_algorithm(codec);
+        size_t numel = payload_bytes / sizeof(float);
+        if (rpc == "forward") {
+            size_t rows = std::max<size_t>(1, numel / sample_elems);
+            leaftest::ForwardPassRequest request;
+            request.set_input_data(payload.data(), rows * sample_elems * sizeof(float));
+            request.add_input_shape(static_cast<int64_t>(rows));
+            request.add_input_shape(static_cast<int64_t>(sample_elems));
+            request.set_model_index(0);
+            leaftest::ForwardPassResponse response;
+            return stub.ForwardPass(&context, request, &response).ok() && response.success();
+        }
+        if (rpc == "gradients") {
+            leaftest::GradientRequest request;
+            request.set_model_state(payload.data(), numel * sizeof(float));
+            leaftest::GradientResponse response;
+            return stub.GetGradients(&context, request, &response).ok() && response.success();
+        }
+        leaftest::StoreModelWeightsRequest request;
+        request.set_model_id(store_model_id(payload_bytes));
+        request.set_model_state(payload.data(), numel * sizeof(float));
+        leaftest::StoreModelWeightsResponse response;
+        return stub.StoreModelWeights(&context, request, &response).ok() && response.success();
+    }
+
+public:
+    RpcBench(const BenchOptions& opts, std::shared_ptr<grpc::Channel> server_channel, size_t max_payload_bytes)
+        : options(opts), channel(std::move(server_channel)),
+          payload(make_payload(std::max(max_payload_bytes, sample_elems * sizeof(float)))) {}
+
+    // Register the identity module and one weight-holding model per payload size
+    void setup(const std::string& identity_definition, const std::vector<std::string>& store_definitions) {
+        auto stub = leaftest::ServerCommunication::NewStub(channel);
+        auto store = [&](const std::string& model_id, const std::string& definition) {
+            grpc::ClientContext context;
+            leaftest::StoreModelWeightsRequest request;
+            request.set_model_id(model_id);
+            request.set_model_definition(definition);
+            leaftest::StoreModelWeightsResponse response;
+            grpc::Status status = stub->StoreModelWeights(&context, request, &response);
+            if (!status.ok() || !response.success()) {
+                throw std::runtime_error("Failed to store " + model_id + ": " +
+                                         (status.ok() ? response.error_message() : status.error_message()));
+            }
+        };
+        store(forward_model_id, identity_definition);
+        for (size_t i = 0; i < store_definitions.size(); ++i) {
+            store(store_model_id(options.payload_bytes[i]), store_definitions[i]);
+        }
+    }
+
+    RunResult run(const std::string& rpc, size_t payload_bytes, size_t concurrency, const std::string& codec_name) {
+        grpc_compression_algorithm codec = parse_codec(codec_name);
+        auto latency_us = std::make_unique<Histogram>();
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> failures{0};
+        std::atomic<size_t> ready{0};
+        std::atomic<bool> started{false};
+        std::atomic<bool> stopping{false};
+
+        std::vector<std::thread> clients;
+        for (size_t t = 0; t < concurrency; ++t) {
+            clients.emplace_back([&] {
+                auto stub = leaftest::ServerCommunication::NewStub(channel);
+                for (size_t i = 0; i < options.warmup_requests; ++i) {
+                    call(*stub, rpc, payload_bytes, codec);
+                }
+                ready.fetch_add(1);
+                while (!started.load()) {
+                    std::this_thread::yield();
+                }
+                while (!stopping.load(std::memory_order_relaxed)) {
+                    auto start = std::chrono::steady_clock::now();
+                    bool ok = call(*stub, rpc, payload_bytes, codec);
+                    latency_us->record(microseconds_since(start));
+                    requests.fetch_add(1, std::memory_order_relaxed);
+                    if (!ok) {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        while (ready.load() < concurrency) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        auto start = std::chrono::steady_clock::now();
+        started.store(true);
+        std::this_thread::sleep_for(std::chrono::duration<double>(options.duration_s));
+        stopping.store(true);
+        for (auto& client : clients) {
+            client.join();
+        }
+
+        RunResult result;
+        result.rpc = rpc;
+        result.payload_bytes = payload_bytes;
+        result.concurrency = concurrency;
+        result.codec = codec_name;
+        result.requests = requests.load();
+        result.failures = failures.load();
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.latency_us = latency_us->summarize();
+        return result;
+    }
+};
+
+void print_result(const RunResult& result) {
+    double requests_per_s = result.requests / result.seconds;
+    std::string notes = result.failures > 0 ? "  (" + std::to_string(result.failures) + " failed)" : "";
+    if (transport_only(result.rpc)) {
+        notes += "  (transport only)";
+    }
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-10s %12zu %5zu %-8s %10.0f req/s %10.1f MB/s  p50 %8llu us  p99 %8llu us  p999 %8llu us%s",
+                  result.rpc.c_str(), result.payload_bytes, result.concurrency, result.codec.c_str(),
+                  requests_per_s, requests_per_s * result.payload_bytes / 1e6,
+                  static_cast<unsigned long long>(result.latency_us.p50),
+                  static_cast<unsigned long long>(result.latency_us.p99),
+                  static_cast<unsigned long long>(result.latency_us.p999),
+                  notes.c_str());
+    std::cout << line << std::endl;
+}
+
+void write_json(const std::string& path, const std::vector<RunResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Cannot write results to " + path);
+    }
+    out << "{\"runs\":[";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const RunResult& result = results[i];
+        double requests_per_s = result.requests / result.seconds;
+        out << (i > 0 ? ",\n" : "\n")
+            << "{\"rpc\":\"" << result.rpc << "\",\"payload_bytes\":" << result.payload_bytes
+            << ",\"concurrency\":" << result.concurrency << ",\"codec\":\"" << result.codec << "\""
+            << ",\"transport_only\":" << (transport_only(result.rpc) ? "true" : "false")
+            << ",\"requests\":" << result.requests << ",\"failures\":" << result.failures
+            << ",\"seconds\":" << result.seconds << ",\"requests_per_s\":" << requests_per_s
+            << ",\"MB_per_s\":" << requests_per_s * result.payload_bytes / 1e6
+            << ",\"latency_us\":{\"mean\":" << result.latency_us.mean << ",\"p50\":" << result.latency_us.p50
+            << ",\"p90\":" << result.latency_us.p90 << ",\"p99\":" << result.latency_us.p99
+            << ",\"p999\":" << result.latency_us.p999 << ",\"max\":" << result.latency_us.max << "}}";
+    }
+    out << "\n]}\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                print_usage(argv[0]);
+                return 0;
+            }
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                print_usage(argv[0]);
+                return 1;
+            }
+            std::string value = argv[++i];
+            if (arg == "--rpc") {
+                options.rpcs = split(value);
+                for (const auto& rpc : options.rpcs) {
+                    if (rpc != "forward" && rpc != "gradients" && rpc != "store") {
+                        throw std::invalid_argument("Unknown RPC '" + rpc + "' (expected forward, gradients or store)");
+                    }
+                }
+            } else if (arg == "--payload-bytes") {
+                options.payload_bytes = split_sizes(value);
+            } else if (arg == "--concurrency") {
+                options.concurrency = split_sizes(value);
+            } else if (arg == "--codec") {
+                options.codecs = split(value);
+                for (const auto& codec : options.codecs) {
+                    parse_codec(codec);
+                }
+            } else if (arg == "--duration-s") {
+                options.duration_s = std::stod(value);
+            } else if (arg == "--warmup") {
+                options.warmup_requests = std::stoull(value);
+            } else if (arg == "--max-batch-size") {
+                options.batching.max_batch_size = std::stoul(value);
+            } else if (arg == "--max-batch-delay-us") {
+                options.batching.max_delay = std::chrono::microseconds(std::stol(value));
+            } else if (arg == "--json") {
+                options.json_path = value;
+            } else {
+                std::cerr << "Unknown option " << arg << std::endl;
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid argument: " << e.what() << std::endl;
+        return 1;
+    }
+    if (options.payload_bytes.empty() || options.concurrency.empty()) {
+        std::cerr << "--payload-bytes and --concurrency need at least one value" << std::endl;
+        return 1;
+    }
+    // Per-request server diagnostics would measure the logger
+    set_log_level(LogLevel::Warn);
+
+    py::scoped_interpreter interpreter;
+    std::string identity_definition = module_definition(0);
+    std::vector<std::string> store_definitions;
+    for (size_t bytes : options.payload_bytes) {
+        store_definitions.push_back(module_definition(bytes / sizeof(float)));
+    }
+    // gRPC threads take the GIL only while running a batch, as in the server binary
+    py::gil_scoped_release release;
+
+    ServerOptions server_options;
+    server_options.batching = options.batching;
+    ServerCommunicationServiceImpl service(server_options);
+    grpc::ServerBuilder builder;
+    configure_server_builder(builder);
+    int port = 0;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    if (!server || port == 0) {
+        std::cerr << "Failed to start the server on a loopback port" << std::endl;
+        return 1;
+    }
+
+    // Same limits as the trainer's channels
+    grpc::ChannelArguments args;
+    args.SetMaxReceiveMessageSize(100 * 1024 * 1024);
+    args.SetMaxSendMessageSize(100 * 1024 * 1024);
+    auto channel = grpc::CreateCustomChannel("127.0.0.1:" + std::to_string(port),
+                                             grpc::InsecureChannelCredentials(), args);
+
+    std::vector<RunResult> results;
+    try {
+        size_t max_payload = *std::max_element(options.payload_bytes.begin(), options.payload_bytes.end());
+        RpcBench bench(options, channel, max_payload);
+        bench.setup(identity_definition, store_definitions);
+        std::cout << "Serving on 127.0.0.1:" << port << "; " << options.duration_s << "s per run" << std::endl;
+        for (const auto& rpc : options.rpcs) {
+            for (size_t payload_bytes : options.payload_bytes) {
+                for (size_t concurrency : options.concurrency) {
+                    for (const auto& codec : options.codecs) {
+                        results.push_back(bench.run(rpc, payload_bytes, concurrency, codec));
+                        print_result(results.back());
+                    }
+                }
+            }
+        }
+        write_json(options.json_path, results);
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        server->Shutdown();
+        return 1;
+    }
+    std::cout << "Wrote " << results.size() << " runs to " << options.json_path << std::endl;
+    server->Shutdown();
+    return 0;
+}
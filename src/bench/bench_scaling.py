@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""Scaling of leaf's orchestration over N server processes on this machine.
+
+Starts server_communication processes on free localhost ports (each pinned to its own slice of
+the CPUs), registers them with LeafConfig.add_endpoint (no SSH or Docker), and trains a fixed
+synthetic MLP with synchronous data-parallel SGD for every N. The batch is split into one slice
+of rows per server, uploaded once; every step then runs through LeafTrainer.train_local_sgd with
+one local step per round: all servers are sent the current weights at once, run forward, backward
+and an SGD step on their slice, and return their weights, which the trainer averages. With plain
+SGD and equal slices that average is exactly one step on the whole batch.
+
+  upload    time outside the rounds, mostly storing the batch slices on the servers, once per run
+  step      one round: weights out, the servers' forward/backward/step, weights back, averaging
+
+Strong scaling keeps the global batch fixed; weak scaling gives every server --batch-size
+samples. Efficiency is throughput relative to the smallest N, divided by the growth in N.
+
+    make server_communication
+    python bench/bench_scaling.py --servers 1,2,4,8 --mode both
+
+Results are printed and written as JSON to leaf_bench_scaling.json (override with --json).
+"""
+
+import argparse
+import json
+import os
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+import torch
+
+from leaf._core import LeafConfig, LeafTrainer
+
+
+def parse_args():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--servers", default="1,2,4",
+                        help="comma separated server counts to run (default: 1,2,4)")
+    parser.add_argument("--mode", choices=["strong", "weak", "both"], default="both")
+    parser.add_argument("--batch-size", type=int, default=256,
+                        help="global batch for strong scaling, per-server batch for weak scaling")
+    parser.add_argument("--input-dim", type=int, default=1024)
+    parser.add_argument("--hidden-dim", type=int, default=1024)
+    parser.add_argument("--layers", type=int, default=4)
+    parser.add_argument("--steps", type=int, default=20, help="timed steps per run")
+    parser.add_argument("--warmup-steps", type=int, default=3)
+    parser.add_argument("--server-binary", default=os.path.join(here, "..", "server_communication"))
+    parser.add_argument("--no-pin", action="store_true",
+                        help="let servers share every CPU instead of pinning each to a slice")
+    parser.add_argument("--json", default="leaf_bench_scaling.json")
+    return parser.parse_args()
+
+
+def free_port():
+    with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as sock:
+        sock.bind(("127.0.0.1", 0))
+        return sock.getsockname()[1]
+
+
+def wait_for_port(port, process, timeout_s=60.0):
+    deadline = time.monotonic() + timeout_s
+    while time.monotonic() < deadline:
+        if process.poll() is not None:
+            raise RuntimeError(f"server on port {port} exited with status {process.returncode}")
+        try:
+            with socket.create_connection(("127.0.0.1", port), timeout=0.5):
+                return
+        except OSError:
+            time.sleep(0.1)
+    raise RuntimeError(f"server on port {port} did not start listening within {timeout_s:.0f}s")
+
+
+def cpu_slices(count):
+    """Split the CPUs we may run on into count contiguous, equally sized lists."""
+    cpus = sorted(os.sched_getaffinity(0))
+    per_server = len(cpus) // count
+    if per_server == 0:
+        return [None] * count
+    return [cpus[i * per_server:(i + 1) * per_server] for i in range(count)]
+
+
+def launch_servers(count, args, log_dir):
+    """Start count servers; every run uses the first N of them, so each server keeps the same
+    CPUs whatever N is."""
+    servers = []
+    slices = [None] * count if args.no_pin else cpu_slices(count)
+    env = dict(os.environ, LEAF_LOG_LEVEL="warn")
+    try:
+        for index in range(count):
+            port = free_port()
+            command = [args.server_binary, "--port", str(port)]
+            if slices[index]:
+                command += ["--cpus", ",".join(map(str, slices[index])),
+                            "--intra-op-threads", str(len(slices[index]))]
+            log = open(os.path.join(log_dir, f"server-{index}.log"), "w")
+            process = subprocess.Popen(command, stdout=log, stderr=subprocess.STDOUT, env=env)
+            servers.append((f"bench-{index}", port, process, log))
+        for _, port, process, _ in servers:
+            wait_for_port(port, process)
+    except Exception:
+        stop_servers(servers)
+        raise
+    return servers
+
+
+def stop_servers(servers):
+    for _, _, process, _ in servers:
+        process.terminate()
+    for _, _, process, log in servers:
+        try:
+            process.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            process.kill()
+            process.wait()
+        log.close()
+
+
+def synthetic_model(args):
+    layers = []
+    width = args.input_dim
+    for _ in range(args.layers):
+        layers += [torch.nn.Linear(width, args.hidden_dim), torch.nn.ReLU()]
+        width = args.hidden_dim
+    layers.append(torch.nn.Linear(width, 10))
+    return torch.nn.Sequential(*layers)
+
+
+def run(servers, per_server_batch, args):
+    config = LeafConfig(include_local=False)
+    for name, port, _, _ in servers:
+        if not config.add_endpoint(name, f"127.0.0.1:{port}"):
+            raise RuntimeError(f"server {name} on port {port} did not answer")
+    trainer = LeafTrainer(config)
+
+    torch.manual_seed(0)
+    model = synthetic_model(args)
+    distributed = trainer.register_model(model)
+    batch_size = per_server_batch * len(servers)
+    inputs = torch.randn(batch_size, args.input_dim)
+    targets = torch.randint(0, 10, (batch_size,))
+
+    # Every round is one step over the whole batch, each server taking its own slice of it
+    start = time.perf_counter()
+    result = trainer.train_local_sgd(distributed, inputs, targets, torch.nn.CrossEntropyLoss(),
+                                     rounds=args.warmup_steps + args.steps, local_steps=1,
+                                     batch_size=per_server_batch,
+                                     servers=[name for name, _, _, _ in servers],
+                                     optimizer="sgd", learning_rate=0.01)
+    total = time.perf_counter() - start
+    rounds = result["rounds"]
+    timed = rounds[args.warmup_steps:]
+    seconds = sum(entry["seconds"] for entry in timed)
+    samples = sum(entry["samples"] for entry in timed)
+    trainer.cleanup_models()
+    return {
+        "batch_size": batch_size,
+        "step_ms": 1000.0 * seconds / args.steps,
+        "samples_per_s": samples / seconds,
+        "bytes_per_step": sum(entry["bytes"] for entry in timed) / args.steps,
+        "final_loss": timed[-1]["loss"],
+        "upload_ms": 1000.0 * (total - sum(entry["seconds"] for entry in rounds)),
+    }
+
+
+def main():
+    args = parse_args()
+    counts = sorted({int(count) for count in args.servers.split(",") if count})
+    if not counts or counts[0] < 1:
+        sys.exit("--servers needs positive counts")
+    if not os.access(args.server_binary, os.X_OK):
+        sys.exit(f"{args.server_binary} is not an executable server (run make server_communication)")
+    modes = ["strong", "weak"] if args.mode == "both" else [args.mode]
+
+    results = []
+    with tempfile.TemporaryDirectory(prefix="leaf-scaling-") as log_dir:
+        servers = launch_servers(counts[-1], args, log_dir)
+        try:
+            for mode in modes:
+                baseline = None
+                for count in counts:
+                    if mode == "strong":
+                        if args.batch_size < count:
+                            sys.exit(f"--batch-size {args.batch_size} is smaller than {count} servers")
+                        per_server_batch = args.batch_size // count
+                    else:
+                        per_server_batch = args.batch_size
+                    result = run(servers[:count], per_server_batch, args)
+                    if baseline is None:
+                        baseline = (count, result["samples_per_s"])
+                    speedup = result["samples_per_s"] / baseline[1]
+                    result.update(mode=mode, servers=count, speedup=speedup,
+                                  efficiency=speedup / (count / baseline[0]))
+                    results.append(result)
+                    print(f"{mode:6s} N={count:<3d} batch {result['batch_size']:6d}"
+                          f"  {result['samples_per_s']:10.1f} samples/s  step {result['step_ms']:8.1f} ms"
+                          f" ({result['bytes_per_step'] / 1e6:.1f} MB)  upload {result['upload_ms']:.1f} ms"
+                          f"  efficiency {100.0 * result['efficiency']:5.1f}%", flush=True)
+        finally:
+            stop_servers(servers)
+
+    with open(args.json, "w") as out:
+        json.dump({"model": {"input_dim": args.input_dim, "hidden_dim": args.hidden_dim,
+                             "layers": args.layers},
+                   "steps": args.steps, "pinned": not args.no_pin, "runs": results}, out, indent=2)
+    print(f"Wrote {len(results)} runs to {args.json}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+// Throughput of the byte paths every training step goes through: flattening a model's state dict,
+// loading it back, splitting forward inputs into request chunks, copying weights into protobuf
+// requests and encoding/decoding those requests on the wire. Sizes run from 1MB to 2GB.
+//
+//   make leaf_bench_serialize && ./leaf_bench_serialize
+//
+// Results are printed and written as JSON to leaf_bench_serialize.json (override with
+// --benchmark_out=PATH); each run's GB counter, a rate in GB/s, is the figure to track. The
+// largest sizes need several GB of memory; --benchmark_filter=/536870912 limits the sizes run.
+
+#include <benchmark/benchmark.h>
+#include <pybind11/embed.h>
+#include "model.h"
+#include "row_chunks.h"
+#include "server_communication.pb.h"
+#include <climits>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace {
+
+constexpr int64_t min_bytes = int64_t(1) << 20;
+constexpr int64_t max_bytes = int64_t(1) << 31;
+// Forward inputs are 1KB samples, so each 32KB chunk carries 32 of them
+constexpr size_t sample_elems = 256;
+
+void report_throughput(benchmark::State& state, int64_t bytes) {
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["GB"] = benchmark::Counter(static_cast<double>(bytes) / 1e9,
+                                                benchmark::Counter::kIsIterationInvariantRate);
+}
+
+std::vector<float> make_floats(size_t count) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<float>(i % 1000) * 0.001f;
+    }
+    return values;
+}
+
+// A torch module whose state dict holds `bytes` of float32 parameters, split into 64MB tensors the
+// way a large network's layers would be. Modules are cached across runs of the same size (and
+// deliberately leaked, since they must not be released after the interpreter shuts down).
+py::object synthetic_model(int64_t bytes) {
+    static auto* models = new std::map<int64_t, py::object>();
+    auto found = models->find(bytes);
+    if (found != models->end()) {
+        return found->second;
+    }
+    py::dict scope;
+    scope["numel"] = bytes / static_cast<int64_t>(sizeof(float));
+    py::exec(R"(
+import torch
+model = torch.nn.Module()
+remaining = numel
+index = 0
+while remaining > 0:
+    size = min(remaining, 16 * 1024 * 1024)
+    model.register_parameter("weight%d" % index, torch.nn.Parameter(torch.rand(size)))
+    remaining -= size
+    index += 1
+)", scope);
+    py::object model = scope["model"];
+    models->emplace(bytes, model);
+    return model;
+}
+
+void BM_SerializeState(benchmark::State& state) {
+    int64_t bytes = state.range(0);
+    Model model(synthetic_model(bytes), nullptr);
+    for (auto _ : state) {
+        std::vector<float> flat = model.serialize_state();
+        benchmark::DoNotOptimize(flat.data());
+    }
+    report_throughput(state, bytes);
+}
+
+void BM_DeserializeState(benchmark::State& state) {
+    int64_t bytes = state.range(0);
+    Model model(synthetic_model(bytes), nullptr);
+    std::vector<float> flat = model.serialize_state();
+    for (auto _ : state) {
+        model.deserialize_state(flat);
+        benchmark::ClobberMemory();
+    }
+    report_throughput(state, bytes);
+}
+
+// The request building loop of forward_pass_on_server without the RPCs: plan the chunks, then copy
+// each chunk's rows and shape into a ForwardPassRequest
+void BM_ForwardChunking(benchmark::State& state) {
+    int64_t bytes = state.range(0);
+    size_t num_rows = static_cast<size_t>(bytes) / (sample_elems * sizeof(float));
+    std::vector<float> input = make_floats(num_rows * sample_elems);
+    for (auto _ : state) {
+        RowChunks chunks = plan_row_chunks(num_rows, sample_elems);
+        for (size_t chunk_idx = 0; chunk_idx < chunks.num_chunks; ++chunk_idx) {
+            size_t start_row = chunk_idx * chunks.rows_per_chunk;
+            size_t chunk_rows = std::min(chunks.rows_per_chunk, num_rows - start_row);
+            leaftest::ForwardPassRequest request;
+            request.set_input_data(input.data() + start_row * sample_elems, chunk_rows * sample_elems * sizeof(float));
+            request.add_input_shape(static_cast<int64_t>(chunk_rows));
+            request.add_input_shape(static_cast<int64_t>(sample_elems));
+            request.set_model_index(0);
+            benchmark::DoNotOptimize(request.input_data().data());
+        }
+    }
+    state.counters["chunks"] = static_cast<double>(plan_row_chunks(num_rows, sample_elems).num_chunks);
+    report_throughput(state, bytes);
+}
+
+// Copying flattened weights into the bytes field of a StoreModelWeights request
+void BM_SetModelState(benchmark::State& state) {
+    int64_t bytes = state.range(0);
+    std::vector<float> flat = make_floats(static_cast<size_t>(bytes) / sizeof(float));
+    for (auto _ : state) {
+        leaftest::StoreModelWeightsRequest request;
+        request.set_model_state(flat.data(), flat.size() * sizeof(float));
+        benchmark::DoNotOptimize(request.model_state().data());
+    }
+    report_throughput(state, bytes);
+}
+
+// Protobuf is the only codec on the wire; serialized messages are limited to 2GB
+bool fits_in_message(benchmark::State& state, int64_t bytes) {
+    if (bytes >= INT_MAX) {
+        state.SkipWithError("payload exceeds protobuf's 2GB message limit");
+        return false;
+    }
+    return true;
+}
+
+void BM_ProtobufEncode(benchmark::State& state) {
+    int64_t bytes = state.range(0);
+    if (!fits_in_message(state, bytes)) {
+        return;
+    }
+    std::vector<float> flat = make_floats(static_cast<size_t>(bytes) / sizeof(float));
+    leaftest::StoreModelWeightsRequest request;
+    request.set_model_state(flat.data(), flat.size() * sizeof(float));
+    request.set_model_id("bench");
+    std::string wire;
+    for (auto _ : state) {
+        request.SerializeToString(&wire);
+        benchmark::DoNotOptimize(wire.data());
+    }
+    report_throughput(state, bytes);
+}
+
+void BM_ProtobufDecode(benchmark::State& state) {
+    int64_t bytes = state.range(0);
+    if (!fits_in_message(state, bytes)) {
+        return;
+    }
+    std::vector<float> flat = make_floats(static_cast<size_t>(bytes) / sizeof(float));
+    std::string wire;
+    {
+        leaftest::StoreModelWeightsRequest request;
+        request.set_model_state(flat.data(), flat.size() * sizeof(float));
+        request.set_model_id("bench");
+        request.SerializeToString(&wire);
+    }
+    flat = std::vector<float>();
+    for (auto _ : state) {
+        leaftest::StoreModelWeightsRequest request;
+        if (!request.ParseFromString(wire)) {
+            state.SkipWithError("failed to parse StoreModelWeightsRequest");
+            break;
+        }
+        benchmark::DoNotOptimize(request.model_state().data());
+    }
+    report_throughput(state, bytes);
+}
+
+void sizes(benchmark::internal::Benchmark* bench) {
+    bench->RangeMultiplier(8)->Range(min_bytes, max_bytes)->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_SerializeState)->Apply(sizes);
+BENCHMARK(BM_DeserializeState)->Apply(sizes);
+BENCHMARK(BM_ForwardChunking)->Apply(sizes);
+BENCHMARK(BM_SetModelState)->Apply(sizes);
+BENCHMARK(BM_ProtobufEncode)->Apply(sizes);
+BENCHMARK(BM_ProtobufDecode)->Apply(sizes);
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    // Write JSON unless the caller chose an output of their own
+    std::vector<char*> args(argv, argv + argc);
+    bool has_out = false;
+    for (int i = 1; i < argc; ++i) {
+        has_out = has_out || std::strncmp(argv[i], "--benchmark_out=", 16) == 0;
+    }
+    std::string out_arg = "--benchmark_out=leaf_bench_serialize.json";
+    std::string format_arg = "--benchmark_out_format=json";
+    if (!has_out) {
+        args.push_back(out_arg.data());
+        args.push_back(format_arg.data());
+    }
+    int args_count = static_cast<int>(args.size());
+
+    py::scoped_interpreter interpreter;
+    benchmark::Initialize(&args_count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
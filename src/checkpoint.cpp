@@ -0,0 +1,215 @@
+#include "checkpoint.h"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+static const char kMagic[8] = {'L', 'E', 'A', 'F', 'C', 'K', 'P', 'T'};
+static const uint32_t kVersion = 1;
+static const uint32_t kAlignment = 4096;  // Fixed rather than the host page size, so files are portable
+static const size_t kHeaderSize = 64;
+static const uint32_t kDtypeFloat32 = 0;
+
+static uint64_t align_up(uint64_t offset) {
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+template <typename T>
+static void append_le(std::string& out, T value) {
+    // Every supported target is little-endian, so the in-memory representation is the file format
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+template <typename T>
+static T read_le(const char* base, uint64_t size, uint64_t& offset) {
+    if (offset + sizeof(T) > size) {
+        throw std::runtime_error("Truncated checkpoint manifest");
+    }
+    T value;
+    std::memcpy(&value, base + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+CheckpointLayout plan_checkpoint(const std::vector<CheckpointTensor>& tensors) {
+    CheckpointLayout layout;
+
+    // Per entry: id length, id, architecture offset/size, dtype, reserved, weights offset/count
+    const size_t entry_fixed_size = 4 * sizeof(uint64_t) + 3 * sizeof(uint32_t);
+    size_t manifest_size = 0;
+    for (const auto& tensor : tensors) {
+        manifest_size += entry_fixed_size + tensor.model_id.size();
+        size_t chunked = 0;
+        for (const auto& chunk : tensor.chunks) {
+            chunked += chunk.second;
+        }
+        if (chunked != tensor.count) {
+            throw std::runtime_error("Checkpoint chunks of model " + tensor.model_id + " do not add up to its weight count");
+        }
+    }
+
+    uint64_t offset = align_up(kHeaderSize + manifest_size);
+    for (const auto& tensor : tensors) {
+        layout.architecture_offsets.push_back(offset);
+        offset = align_up(offset + tensor.architecture.size());
+        layout.weights_offsets.push_back(offset);
+        offset = align_up(offset + tensor.count * sizeof(float));
+    }
+    layout.file_size = offset;
+
+    std::string& out = layout.metadata;
+    out.reserve(kHeaderSize + manifest_size);
+    out.append(kMagic, sizeof(kMagic));
+    append_le<uint32_t>(out, kVersion);
+    append_le<uint32_t>(out, kAlignment);
+    append_le<uint64_t>(out, tensors.size());
+    append_le<uint64_t>(out, kHeaderSize);
+    append_le<uint64_t>(out, manifest_size);
+    append_le<uint64_t>(out, layout.file_size);
+    out.resize(kHeaderSize, '\0');
+
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        const CheckpointTensor& tensor = tensors[i];
+        append_le<uint32_t>(out, static_cast<uint32_t>(tensor.model_id.size()));
+        out += tensor.model_id;
+        append_le<uint64_t>(out, layout.architecture_offsets[i]);
+        append_le<uint64_t>(out, tensor.architecture.size());
+        append_le<uint32_t>(out, kDtypeFloat32);
+        append_le<uint32_t>(out, 0);
+        append_le<uint64_t>(out, layout.weights_offsets[i]);
+        append_le<uint64_t>(out, tensor.count);
+    }
+    return layout;
+}
+
+static bool pwrite_all(int fd, const void* data, size_t size, uint64_t offset) {
+    const size_t max_write = 8 * 1024 * 1024;  // 8MB sequential writes
+    const char* bytes = static_cast<const char*>(data);
+    size_t written = 0;
+    while (written < size) {
+        size_t chunk = size - written < max_write ? size - written : max_write;
+        ssize_t n = ::pwrite(fd, bytes + written, chunk, static_cast<off_t>(offset + written));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool write_checkpoint_fd(int fd, const CheckpointLayout& layout, const std::vector<CheckpointTensor>& tensors) {
+    if (!pwrite_all(fd, layout.metadata.data(), layout.metadata.size(), 0)) {
+        return false;
+    }
+
+    // Chunks smaller than this are coalesced in the staging buffer; larger ones go straight to disk
+    const size_t staging_capacity = 8 * 1024 * 1024;
+    std::vector<char> staging;
+    uint64_t staging_offset = 0;
+    auto flush = [&]() {
+        bool ok = pwrite_all(fd, staging.data(), staging.size(), staging_offset);
+        staging.clear();
+        return ok;
+    };
+
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        const CheckpointTensor& tensor = tensors[i];
+        if (!pwrite_all(fd, tensor.architecture.data(), tensor.architecture.size(), layout.architecture_offsets[i])) {
+            return false;
+        }
+        uint64_t offset = layout.weights_offsets[i];
+        for (const auto& chunk : tensor.chunks) {
+            size_t bytes = chunk.second * sizeof(float);
+            bool contiguous = !staging.empty() && staging_offset + staging.size() == offset;
+            if (!staging.empty() && (!contiguous || staging.size() + bytes > staging_capacity)) {
+                if (!flush()) {
+                    return false;
+                }
+            }
+            if (bytes >= staging_capacity) {
+                if (!pwrite_all(fd, chunk.first, bytes, offset)) {
+                    return false;
+                }
+            } else {
+                if (staging.empty()) {
+                    staging.reserve(staging_capacity);
+                    staging_offset = offset;
+                }
+                const char* data = reinterpret_cast<const char*>(chunk.first);
+                staging.insert(staging.end(), data, data + bytes);
+            }
+            offset += bytes;
+        }
+    }
+    if (!staging.empty() && !flush()) {
+        return false;
+    }
+    // Extend over the padding after the last tensor so the file size matches the header
+    return ::ftruncate(fd, static_cast<off_t>(layout.file_size)) == 0;
+}
+
+CheckpointFile::CheckpointFile(const std::string& path) : mapping(std::make_shared<MappedFile>(path)) {
+    const char* base = static_cast<const char*>(mapping->data());
+    uint64_t size = mapping->size();
+    if (size < kHeaderSize || std::memcmp(base, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error(path + " is not a checkpoint");
+    }
+
+    uint64_t offset = sizeof(kMagic);
+    uint32_t version = read_le<uint32_t>(base, size, offset);
+    uint32_t alignment = read_le<uint32_t>(base, size, offset);
+    uint64_t model_count = read_le<uint64_t>(base, size, offset);
+    uint64_t manifest_offset = read_le<uint64_t>(base, size, offset);
+    uint64_t manifest_size = read_le<uint64_t>(base, size, offset);
+    uint64_t file_size = read_le<uint64_t>(base, size, offset);
+    if (version != kVersion) {
+        throw std::runtime_error(path + " has unsupported checkpoint version " + std::to_string(version));
+    }
+    if (file_size != size || manifest_offset > size || manifest_size > size - manifest_offset || alignment == 0) {
+        throw std::runtime_error(path + " is truncated");
+    }
+
+    uint64_t manifest_end = manifest_offset + manifest_size;
+    offset = manifest_offset;
+    for (uint64_t i = 0; i < model_count; ++i) {
+        Entry entry;
+        uint32_t id_size = read_le<uint32_t>(base, manifest_end, offset);
+        if (offset + id_size > manifest_end) {
+            throw std::runtime_error("Truncated checkpoint manifest");
+        }
+        entry.model_id.assign(base + offset, id_size);
+        offset += id_size;
+        entry.architecture_offset = read_le<uint64_t>(base, manifest_end, offset);
+        entry.architecture_size = read_le<uint64_t>(base, manifest_end, offset);
+        uint32_t dtype = read_le<uint32_t>(base, manifest_end, offset);
+        read_le<uint32_t>(base, manifest_end, offset);
+        entry.weights_offset = read_le<uint64_t>(base, manifest_end, offset);
+        entry.weights_count = read_le<uint64_t>(base, manifest_end, offset);
+
+        if (dtype != kDtypeFloat32) {
+            throw std::runtime_error("Unsupported dtype for model " + entry.model_id + " in " + path);
+        }
+        if (entry.architecture_offset > size || entry.architecture_size > size - entry.architecture_offset ||
+            entry.weights_offset % alignment != 0 || entry.weights_offset > size ||
+            entry.weights_count > (size - entry.weights_offset) / sizeof(float)) {
+            throw std::runtime_error("Model " + entry.model_id + " lies outside " + path);
+        }
+        entries.push_back(std::move(entry));
+    }
+}
+
+std::string CheckpointFile::architecture(const Entry& entry) const {
+    const char* base = static_cast<const char*>(mapping->data());
+    return std::string(base + entry.architecture_offset, entry.architecture_size);
+}
+
+const float* CheckpointFile::weights(const Entry& entry) const {
+    const char* base = static_cast<const char*>(mapping->data());
+    return reinterpret_cast<const float*>(base + entry.weights_offset);
+}
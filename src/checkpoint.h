@@ -0,0 +1,74 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "mapped_file.h"
+
+// On-disk checkpoint of stored models, designed to be memory-mapped on startup.
+//
+// Layout (all integers little-endian):
+//   header    64 bytes: magic "LEAFCKPT", u32 version, u32 alignment, u64 model count,
+//             u64 manifest offset, u64 manifest size, u64 file size, reserved
+//   manifest  per model: u32 id length, id bytes, u64 architecture offset, u64 architecture size,
+//             u32 dtype, u32 reserved, u64 weights offset, u64 weight count
+//   payload   each architecture blob and weight tensor starts on a page boundary, so the weights
+//             can be used straight from the mapping without copying or realigning
+//
+// The architecture blob is the torch.save()d module with its tensors on the meta device; the
+// weights are the flat float32 state in Model::serialize_state order.
+
+// One model's contribution to a checkpoint; the caller keeps the data alive while writing.
+// The weights may be gathered from several buffers (e.g. one per tensor) written back to back.
+struct CheckpointTensor {
+    std::string model_id;
+    std::string architecture;
+    std::vector<std::pair<const float*, size_t>> chunks;
+    size_t count = 0;  // Total floats across chunks
+};
+
+// Where each part of a checkpoint goes, computed before anything is written
+struct CheckpointLayout {
+    std::string metadata;                     // Header and manifest, written at offset 0
+    std::vector<uint64_t> architecture_offsets;
+    std::vector<uint64_t> weights_offsets;
+    uint64_t file_size = 0;
+};
+
+class CheckpointFile {
+public:
+    struct Entry {
+        std::string model_id;
+        uint64_t architecture_offset;
+        uint64_t architecture_size;
+        uint64_t weights_offset;
+        uint64_t weights_count;
+    };
+
+private:
+    std::shared_ptr<MappedFile> mapping;
+    std::vector<Entry> entries;
+
+public:
+    // Map and validate a checkpoint; throws std::runtime_error if it is missing or malformed
+    explicit CheckpointFile(const std::string& path);
+
+    const std::vector<Entry>& get_entries() const { return entries; }
+    std::string architecture(const Entry& entry) const;
+    const float* weights(const Entry& entry) const;
+
+    // The mapping backing the weights; holding it keeps weights() valid after this object is gone
+    std::shared_ptr<const MappedFile> get_mapping() const { return mapping; }
+};
+
+CheckpointLayout plan_checkpoint(const std::vector<CheckpointTensor>& tensors);
+
+// Write a planned checkpoint to an open descriptor. Small chunks are staged so the file is written
+// in large sequential writes. Returns false on I/O failure with errno set; does not fsync.
+bool write_checkpoint_fd(int fd, const CheckpointLayout& layout, const std::vector<CheckpointTensor>& tensors);
+
+#endif // CHECKPOINT_H
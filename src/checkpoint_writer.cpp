@@ -0,0 +1,174 @@
+#include "checkpoint_writer.h"
+#include "logging.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+CheckpointWriter::CheckpointWriter() : writing(false), stopping(false) {}
+
+CheckpointWriter::~CheckpointWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_cv.notify_all();
+    // Queued checkpoints are still written before the thread exits
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void CheckpointWriter::submit(CheckpointJob job) {
+    std::vector<std::shared_ptr<const void>> superseded;  // Released outside the mutex
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.submitted++;
+        bool replaced = false;
+        for (auto& queued : queue) {
+            if (queued.path == job.path) {
+                superseded = std::move(queued.keepalive);
+                queued = std::move(job);
+                stats.superseded++;
+                replaced = true;
+                break;
+            }
+        }
+        if (!replaced) {
+            queue.push_back(std::move(job));
+        }
+        if (!thread.joinable()) {
+            thread = std::thread(&CheckpointWriter::run, this);
+        }
+    }
+    work_cv.notify_one();
+}
+
+bool CheckpointWriter::flush(std::string* error) {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle_cv.wait(lock, [this] { return queue.empty() && !writing; });
+    if (unreported_error.empty()) {
+        return true;
+    }
+    if (error) {
+        *error = unreported_error;
+    }
+    unreported_error.clear();
+    return false;
+}
+
+CheckpointWriterStats CheckpointWriter::get_stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void CheckpointWriter::run() {
+    while (true) {
+        std::vector<CheckpointJob> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_cv.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+            for (auto& job : queue) {
+                batch.push_back(std::move(job));
+            }
+            queue.clear();
+            writing = true;
+        }
+
+        write_batch(batch);
+        batch.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            writing = false;
+        }
+        idle_cv.notify_all();
+    }
+}
+
+void CheckpointWriter::write_batch(std::vector<CheckpointJob>& batch) {
+    struct PendingFile {
+        std::string path;
+        std::string tmp_path;
+        int fd;
+    };
+    std::vector<PendingFile> pending;
+    std::vector<std::string> errors;
+    uint64_t bytes = 0;
+
+    // Write every file first; the data is in the page cache once write() returns, so the buffers
+    // can be released before the comparatively slow fsyncs
+    for (auto& job : batch) {
+        std::string tmp_path = job.path + ".tmp";
+        try {
+            CheckpointLayout layout = plan_checkpoint(job.tensors);
+            int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0) {
+                throw std::runtime_error("Failed to create " + tmp_path + ": " + std::strerror(errno));
+            }
+            if (!write_checkpoint_fd(fd, layout, job.tensors)) {
+                int err = errno;
+                ::close(fd);
+                ::unlink(tmp_path.c_str());
+                throw std::runtime_error("Failed to write " + tmp_path + ": " + std::strerror(err));
+            }
+            pending.push_back({job.path, tmp_path, fd});
+            bytes += layout.file_size;
+        } catch (const std::exception& e) {
+            errors.push_back(e.what());
+        }
+        job.tensors.clear();
+        job.keepalive.clear();
+    }
+
+    // One round of fsyncs for the whole batch, then the renames that publish the files
+    std::set<std::string> directories;
+    size_t written = 0;
+    for (const auto& file : pending) {
+        if (fsync(file.fd) != 0) {
+            errors.push_back("Failed to fsync " + file.tmp_path + ": " + std::strerror(errno));
+            ::close(file.fd);
+            ::unlink(file.tmp_path.c_str());
+            continue;
+        }
+        ::close(file.fd);
+        // Readers still mapping the previous checkpoint keep its inode alive across the rename
+        if (std::rename(file.tmp_path.c_str(), file.path.c_str()) != 0) {
+            errors.push_back("Failed to rename " + file.tmp_path + " to " + file.path + ": " + std::strerror(errno));
+            ::unlink(file.tmp_path.c_str());
+            continue;
+        }
+        size_t slash = file.path.find_last_of('/');
+        directories.insert(slash == std::string::npos ? "." : file.path.substr(0, slash + 1));
+        written++;
+    }
+    // Make the renames themselves durable, once per directory
+    for (const auto& directory : directories) {
+        int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+        if (fd >= 0) {
+            fsync(fd);
+            ::close(fd);
+        }
+    }
+
+    for (const auto& error : errors) {
+        LEAF_LOG_ERROR("CheckpointWriter: " << error);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.written += written;
+    stats.failed += errors.size();
+    stats.bytes_written += bytes;
+    stats.syncs++;
+    if (!errors.empty()) {
+        stats.last_error = errors.back();
+        if (unreported_error.empty()) {
+            unreported_error = errors.front();
+        }
+    }
+}
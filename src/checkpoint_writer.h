@@ -0,0 +1,72 @@
+#ifndef CHECKPOINT_WRITER_H
+#define CHECKPOINT_WRITER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "checkpoint.h"
+
+// A checkpoint waiting to be written. keepalive owns the buffers the tensors point into and is
+// released as soon as the data has been written, before the file is synced.
+struct CheckpointJob {
+    std::string path;
+    std::vector<CheckpointTensor> tensors;
+    std::vector<std::shared_ptr<const void>> keepalive;
+};
+
+struct CheckpointWriterStats {
+    uint64_t submitted = 0;
+    uint64_t written = 0;
+    uint64_t superseded = 0;  // Dropped because a newer checkpoint of the same path was queued
+    uint64_t failed = 0;
+    uint64_t bytes_written = 0;
+    uint64_t syncs = 0;       // fsync batches issued
+    std::string last_error;
+};
+
+// Writes checkpoints on a background I/O thread so callers only pay for taking the snapshot.
+//
+// Everything queued while a batch is being written forms the next batch. Within a batch, a newer
+// checkpoint of a path supersedes an older one that has not started, every file is written before
+// any is synced, and each directory is synced once after the renames.
+//
+// keepalive objects are destroyed on the writer thread, so ones that need the GIL must acquire it,
+// and flush() must not be called while holding it.
+class CheckpointWriter {
+private:
+    mutable std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable idle_cv;
+    std::deque<CheckpointJob> queue;
+    bool writing;
+    bool stopping;
+    CheckpointWriterStats stats;
+    std::string unreported_error;  // First failure since the last flush()
+    std::thread thread;            // Started on first submit
+
+    void run();
+    void write_batch(std::vector<CheckpointJob>& batch);
+
+public:
+    CheckpointWriter();
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    void submit(CheckpointJob job);
+
+    // Block until everything submitted so far is on disk. Returns false if a checkpoint failed
+    // since the previous flush, with the reason in *error.
+    bool flush(std::string* error);
+
+    CheckpointWriterStats get_stats() const;
+};
+
+#endif // CHECKPOINT_WRITER_H
@@ -29,11 +29,22 @@
 #include "distributed_model.h"
 #include "criterion.h"
 #include "core.h"
+#include "logging.h"
+#include "flat_optimizer.h"
 
 namespace py = pybind11;
 
 PYBIND11_MODULE(_core, m) {
-    std::cout << "Initializing _core module..." << std::endl;
+    LEAF_LOG_DEBUG("Initializing _core module...");
+    
+    // Threshold for the extension's diagnostics; LEAF_LOG_LEVEL sets the initial one
+    m.def("set_log_level", [](const std::string& level) { set_log_level(parse_log_level(level)); },
+          py::arg("level"));
+    m.def("get_log_level", []() { return std::string(log_level_name(get_log_level())); });
+    m.def("flush_logs", []() {
+        py::gil_scoped_release release;
+        log_flush();
+    });
     
     py::class_<Criterion, std::shared_ptr<Criterion>>(m, "Criterion")
         .def(py::init<py::object, LeafTrainer*>(),
@@ -49,6 +60,9 @@ PYBIND11_MODULE(_core, m) {
         .def("get_stored_targets", &Criterion::get_stored_targets)
         .def("get_divided_targets", &Criterion::get_divided_targets)
         .def("clear_stored_data", &Criterion::clear_stored_data)
+        .def("set_max_stored_bytes", &Criterion::set_max_stored_bytes, py::arg("max_bytes"))
+        .def("get_max_stored_bytes", &Criterion::get_max_stored_bytes)
+        .def("get_stored_bytes", &Criterion::get_stored_bytes)
         .def("getattr", &Criterion::getattr)
         .def("setattr", &Criterion::setattr)
         .def("hasattr", &Criterion::hasattr)
@@ -63,7 +77,11 @@ PYBIND11_MODULE(_core, m) {
         .def("get_leaf_trainer", &Model::get_leaf_trainer)
         .def("has_computed_outputs", &Model::has_computed_outputs)
         .def("get_stored_outputs", &Model::get_stored_outputs)
+        .def("take_stored_output", &Model::take_stored_output)
         .def("clear_stored_outputs", &Model::clear_stored_outputs)
+        .def("set_max_stored_output_bytes", &Model::set_max_stored_output_bytes, py::arg("max_bytes"))
+        .def("get_max_stored_output_bytes", &Model::get_max_stored_output_bytes)
+        .def("get_stored_output_bytes", &Model::get_stored_output_bytes)
         .def("state_dict", &Model::state_dict)
         .def("parameters", &Model::parameters)
         .def("named_parameters", &Model::named_parameters)
@@ -86,6 +104,7 @@ PYBIND11_MODULE(_core, m) {
         .def("get_pytorch_model", &DistributedModel::get_pytorch_model)
         .def("get_leaf_trainer", &DistributedModel::get_leaf_trainer)
         .def("get_index", &DistributedModel::get_index)
+        .def("get_last_request_id", &DistributedModel::get_last_request_id)
         .def("state_dict", &DistributedModel::state_dict)
         .def("parameters", &DistributedModel::parameters)
         .def("named_parameters", &DistributedModel::named_parameters)
@@ -101,19 +120,79 @@ PYBIND11_MODULE(_core, m) {
         .def("deserialize_state", &DistributedModel::deserialize_state);
 
     py::class_<LeafConfig>(m, "LeafConfig")
-        .def(py::init<>())
+        .def(py::init<bool>(), py::arg("include_local") = true)
         .def("add_server", &LeafConfig::add_server,
              py::arg("server_name"),
              py::arg("username"),
              py::arg("hostname"),
              py::arg("port") = 22,
              py::arg("key_path") = "")
+        .def("add_servers", &LeafConfig::add_servers,
+             py::arg("server_specs"),
+             py::arg("max_parallel") = 0,
+             py::arg("progress") = py::none())
+        .def("add_endpoint", &LeafConfig::add_endpoint,
+             py::arg("server_name"),
+             py::arg("address"))
         .def("get_servers", &LeafConfig::get_servers)
         .def("get_server_info", &LeafConfig::get_server_info)
         .def("remove_server", &LeafConfig::remove_server)
         .def("print_all_resources", &LeafConfig::print_all_resources)
+        .def("refresh_resources", &LeafConfig::refresh_resources, py::arg("server_name") = "")
         .def("get_server_connection_info", &LeafConfig::get_server_connection_info);
 
+    // Optimizer steps over flat float32 buffers in native code: parameters must be a writable,
+    // C-contiguous float32 array (e.g. a flat tensor's .numpy()) and is updated in place
+    m.def("optimizer_isa", &optimizer_isa);
+    py::class_<FlatOptimizer>(m, "FlatOptimizer")
+        .def(py::init([](const std::string& optimizer, size_t size, float learning_rate, float momentum,
+                         bool nesterov, float beta1, float beta2, float epsilon, float weight_decay,
+                         unsigned threads) {
+                 OptimizerOptions options;
+                 options.kind = parse_optimizer_kind(optimizer);
+                 options.learning_rate = learning_rate;
+                 options.momentum = momentum;
+                 options.nesterov = nesterov;
+                 options.beta1 = beta1;
+                 options.beta2 = beta2;
+                 options.epsilon = epsilon;
+                 options.weight_decay = weight_decay;
+                 options.threads = threads;
+                 return std::make_unique<FlatOptimizer>(options, size);
+             }),
+             py::arg("optimizer"),
+             py::arg("size"),
+             py::arg("learning_rate") = 0.01f,
+             py::arg("momentum") = 0.0f,
+             py::arg("nesterov") = false,
+             py::arg("beta1") = 0.9f,
+             py::arg("beta2") = 0.999f,
+             py::arg("epsilon") = 1e-8f,
+             py::arg("weight_decay") = 0.0f,
+             py::arg("threads") = 0)
+        .def("step", [](FlatOptimizer& optimizer, py::array_t<float, py::array::c_style> parameters,
+                        py::array_t<float, py::array::c_style | py::array::forcecast> gradients, float grad_scale) {
+                 if (parameters.size() != gradients.size()) {
+                     throw std::invalid_argument("Got " + std::to_string(gradients.size()) + " gradients for " +
+                                                 std::to_string(parameters.size()) + " parameters");
+                 }
+                 float* data = parameters.mutable_data();
+                 py::gil_scoped_release release;
+                 optimizer.step(data, gradients.data(), static_cast<size_t>(gradients.size()), grad_scale);
+             },
+             py::arg("parameters").noconvert(),
+             py::arg("gradients"),
+             py::arg("grad_scale") = 1.0f)
+        .def("size", &FlatOptimizer::size)
+        .def("get_steps", &FlatOptimizer::get_steps);
+
+    py::class_<TraceScope>(m, "TraceScope")
+        .def("__enter__", [](TraceScope& scope) -> TraceScope& {
+            scope.enter();
+            return scope;
+        }, py::return_value_policy::reference)
+        .def("__exit__", [](TraceScope& scope, py::args) { scope.exit(); });
+
     py::class_<LeafTrainer>(m, "LeafTrainer")
         .def(py::init<const LeafConfig&>())
         .def("train", &LeafTrainer::train,
@@ -128,7 +207,67 @@ PYBIND11_MODULE(_core, m) {
         .def("get_model_count", &LeafTrainer::get_model_count)
         .def("get_server_names", &LeafTrainer::get_server_names)
         .def("get_server_info", &LeafTrainer::get_server_info)
-        .def("store_model_weights_on_server", &LeafTrainer::store_model_weights_on_server);
+        .def("store_model_weights_on_server", &LeafTrainer::store_model_weights_on_server)
+        .def("checkpoint", &LeafTrainer::checkpoint,
+             py::arg("path"),
+             py::arg("include_servers") = true)
+        .def("wait_for_checkpoints", &LeafTrainer::wait_for_checkpoints)
+        .def("start_heartbeats", &LeafTrainer::start_heartbeats, py::arg("interval_ms") = 1000)
+        .def("stop_heartbeats", &LeafTrainer::stop_heartbeats)
+        .def("get_server_load", &LeafTrainer::get_server_load)
+        .def("get_stats", &LeafTrainer::get_stats, py::arg("include_servers") = true)
+        .def("start_trace", &LeafTrainer::start_trace)
+        .def("stop_trace", &LeafTrainer::stop_trace, py::arg("path"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("set_trace_step", &LeafTrainer::set_trace_step, py::arg("step"))
+        .def("trace_span", &LeafTrainer::trace_span, py::arg("name"), py::arg("category") = "python")
+        .def("create_parameter_shards", &LeafTrainer::create_parameter_shards,
+             py::arg("model_id"),
+             py::arg("parameters"),
+             py::arg("servers"),
+             py::arg("learning_rate") = 0.01f,
+             py::arg("momentum") = 0.0f,
+             py::arg("weight_decay") = 0.0f,
+             py::arg("workers") = 1,
+             py::arg("optimizer") = "sgd",
+             py::arg("beta1") = 0.9f,
+             py::arg("beta2") = 0.999f,
+             py::arg("epsilon") = 1e-8f)
+        .def("push_gradients", &LeafTrainer::push_gradients, py::arg("model_id"), py::arg("gradients"))
+        .def("pull_parameters", &LeafTrainer::pull_parameters,
+             py::arg("model_id"),
+             py::arg("min_version") = 0,
+             py::arg("wait_ms") = 0,
+             py::arg("servers") = std::vector<std::string>())
+        .def("train_local_sgd", &LeafTrainer::train_local_sgd,
+             py::arg("model"),
+             py::arg("inputs"),
+             py::arg("targets"),
+             py::arg("criterion"),
+             py::arg("rounds"),
+             py::arg("local_steps"),
+             py::arg("batch_size") = 32,
+             py::arg("servers") = std::vector<std::string>(),
+             py::arg("optimizer") = "sgd",
+             py::arg("learning_rate") = 0.01f,
+             py::arg("momentum") = 0.0f,
+             py::arg("weight_decay") = 0.0f,
+             py::arg("seed") = 0)
+        .def("train_async_sgd", &LeafTrainer::train_async_sgd,
+             py::arg("model"),
+             py::arg("inputs"),
+             py::arg("targets"),
+             py::arg("criterion"),
+             py::arg("updates"),
+             py::arg("batch_size") = 32,
+             py::arg("max_staleness") = 4,
+             py::arg("stale_policy") = "drop",
+             py::arg("servers") = std::vector<std::string>(),
+             py::arg("optimizer") = "sgd",
+             py::arg("learning_rate") = 0.01f,
+             py::arg("momentum") = 0.0f,
+             py::arg("weight_decay") = 0.0f,
+             py::arg("seed") = 0);
         
-    std::cout << "_core module initialization complete!" << std::endl;
+    LEAF_LOG_DEBUG("_core module initialization complete!");
 } 
\ No newline at end of file
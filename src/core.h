@@ -21,14 +21,18 @@
 #include <chrono>
 #include <set>
 #include <mutex>
+#include <atomic>
 #include <grpc/grpc.h>
 #include <grpcpp/grpcpp.h>
 #include "server_communication.pb.h"
 #include "server_communication.grpc.pb.h"
 #include "server_communication.h"
+#include "checkpoint_writer.h"
+#include "heartbeat_monitor.h"
 #include "user_credentials.h"
 #include "server.h"
 #include "model.h"
+#include "trace.h"
 
 namespace py = pybind11;
 
@@ -43,7 +47,8 @@ private:
     void print_server_info(const Server& server) const;
 
 public:
-    LeafConfig();
+    // include_local adds this machine as the "localhost" server, which runs models in-process
+    explicit LeafConfig(bool include_local = true);
 
     void add_server(const std::string& server_name,
                    const std::string& username,
@@ -51,10 +56,26 @@ public:
                    int port = 22,
                    const std::string& key_path = "");
 
+    // Provision several servers in parallel. Each spec is a dict with the add_server arguments
+    // (server_name, username, hostname and optionally port and key_path). Servers on the same
+    // host are provisioned one after another since they share its build directory and container.
+    // progress, if given, is called as progress(server_name, connected, completed, total) as each
+    // server finishes. Returns {server_name: connected}.
+    py::dict add_servers(py::list server_specs,
+                         size_t max_parallel = 0,
+                         py::object progress = py::none());
+
+    // Register a server_communication process already listening at address (host:port), without
+    // SSH or Docker. Returns whether it answered; an unreachable server is kept but not connected.
+    bool add_endpoint(const std::string& server_name, const std::string& address);
+
     std::vector<std::string> get_servers() const;
     py::dict get_server_info(const std::string& server_name) const;
     void remove_server(const std::string& server_name);
     void print_all_resources() const;
+    // Re-query the resources of one server, or of every server if server_name is empty; remote
+    // servers answer with one GetResources RPC, so this is cheap enough to call before scheduling
+    void refresh_resources(const std::string& server_name = "");
     std::pair<int, std::string> get_server_connection_info(const std::string& server_name) const;
 };
 
@@ -67,24 +88,75 @@ private:
     std::vector<std::shared_ptr<DistributedModel>> distributed_models; // Track distributed models
     mutable std::mutex models_mutex;  // Protect access to local_models
 
+    // Checkpoints are written in the background. Parameters a pending checkpoint still references
+    // are recorded here, and an optimizer step pre-hook gives them private storage before they are
+    // updated in place (copy-on-write). Only touched under the GIL.
+    struct CheckpointShare {
+        std::weak_ptr<const void> snapshot;
+        py::object parameter;
+        uintptr_t data_ptr;
+    };
+    CheckpointWriter checkpoint_writer;
+    std::vector<CheckpointShare> checkpoint_shares;
+    py::object step_hook_handle;
+
+    // Load and liveness of the remote servers; calls to a server that stops sending heartbeats
+    // are cancelled instead of running into their deadline
+    HeartbeatMonitor heartbeat_monitor;
+
+    // Which parameter server holds which slice of each sharded model's flat parameter vector
+    struct ParameterShardLayout {
+        std::vector<std::string> servers;
+        std::vector<std::pair<size_t, size_t>> ranges;  // {offset, count} per server
+        size_t total_count = 0;
+    };
+    std::map<std::string, ParameterShardLayout> parameter_layouts;
+    std::mutex layout_mutex;
+
+    // Request ids pair a forward pass with the backward step that consumes its retained output;
+    // the nonce keeps ids of different trainers apart on a shared server
+    uint64_t request_nonce;
+    std::atomic<uint64_t> request_counter{0};
+
+    void break_checkpoint_sharing();
     std::shared_ptr<grpc::Channel> create_channel(const std::string& server_name);
-    std::pair<std::vector<float>, float> get_gradients_from_server(
+    // Cached channel to server_name, created on first use
+    std::shared_ptr<grpc::Channel> get_channel(const std::string& server_name);
+    ParameterShardLayout get_parameter_layout(const std::string& model_id);
+    // The given servers, or every connected remote server if none are given, with their channels;
+    // throws if one is not a connected remote server
+    std::vector<std::string> training_servers(const std::vector<std::string>& servers,
+                                              std::vector<std::shared_ptr<grpc::Channel>>* channels);
+    // Split the rows of inputs and targets evenly over workers and store them there as shard_id;
+    // returns the number of rows
+    size_t upload_data_shards(const std::string& shard_id,
+                              py::object inputs,
+                              py::object targets,
+                              const std::vector<std::string>& workers,
+                              const std::vector<std::shared_ptr<grpc::Channel>>& channels);
+    std::pair<py::array_t<float>, float> get_gradients_from_server(
         const std::string& server_name,
         py::object inputs,
         py::object model,
         py::object criterion,
         py::object optimizer,
-        bool is_local = false);
+        bool is_local = false,
+        const std::string& request_id = "");
     std::vector<std::pair<std::string, std::vector<size_t>>> distribute_batch(
         const std::vector<std::string>& server_names,
         size_t batch_size);
 
 public:
+    // Forward inputs through a registered model on a server. With a request_id the server keeps
+    // the output until the GetGradients call with the same id reads it.
     py::object forward_pass_on_server(
         const std::string& server_name,
         py::object inputs,
         uint32_t model_index,
-        bool is_local = false);
+        bool is_local = false,
+        const std::string& request_id = "");
+    // A request id no other forward pass of this trainer has used
+    std::string new_request_id();
     LeafTrainer(const LeafConfig& cfg);
     ~LeafTrainer();
     
@@ -109,6 +181,105 @@ public:
                    int epochs,
                    py::object criterion = py::none());
     py::dict test_with_hardcoded_values();
+    
+    // Snapshot the registered models and write them to path in the background, asking connected
+    // servers to checkpoint their stored models too. Returns once the snapshot is taken.
+    py::dict checkpoint(const std::string& path, bool include_servers = true);
+    
+    // Block until every checkpoint written by this trainer is on disk; throws if one failed
+    void wait_for_checkpoints();
+    
+    // Subscribe to heartbeats from every connected remote server, sent every interval_ms
+    void start_heartbeats(uint32_t interval_ms = 1000);
+    void stop_heartbeats();
+    
+    // Latest heartbeat per monitored server: liveness, queue depth, requests in flight, recent
+    // step times, CPU use and RSS
+    py::dict get_server_load() const;
+    
+    // Counters and latency histograms of this trainer's RPCs and serialization, plus those of
+    // every connected remote server when include_servers is set. Latencies are in microseconds.
+    py::dict get_stats(bool include_servers = true);
+    
+    // Record spans of every phase (trainer serialization, RPCs, and the servers' queueing,
+    // forward and backward) until stop_trace writes them to path as Chrome trace_event JSON.
+    // Returns the number of events written.
+    void start_trace();
+    size_t stop_trace(const std::string& path);
+    // Step number attached to spans recorded from now on
+    void set_trace_step(int64_t step);
+    // Span for a phase run from Python, e.g. `with trainer.trace_span("optimizer"): optimizer.step()`
+    TraceScope trace_span(const std::string& name, const std::string& category = "python");
+    
+    // Split a model's flat parameters (in serialize_state order) into contiguous shards, one per
+    // server, each started with --role parameter-server or both. The servers then own the weights
+    // and apply the optimizer ("sgd", "adam" or "adamw") to the gradients pushed to them.
+    // With workers > 1 a shard averages that many pushes into each update.
+    void create_parameter_shards(const std::string& model_id,
+                                 py::array_t<float, py::array::c_style | py::array::forcecast> parameters,
+                                 const std::vector<std::string>& servers,
+                                 float learning_rate = 0.01f,
+                                 float momentum = 0.0f,
+                                 float weight_decay = 0.0f,
+                                 uint32_t workers = 1,
+                                 const std::string& optimizer = "sgd",
+                                 float beta1 = 0.9f,
+                                 float beta2 = 0.999f,
+                                 float epsilon = 1e-8f);
+    
+    // Send every shard its slice of the flat gradients; returns the oldest shard version after the push
+    uint64_t push_gradients(const std::string& model_id,
+                            py::array_t<float, py::array::c_style | py::array::forcecast> gradients);
+    
+    // Gather the flat parameters from the shards once each reaches min_version, waiting up to
+    // wait_ms. A trainer that did not create the shards passes their servers in order to attach.
+    py::array_t<float> pull_parameters(const std::string& model_id,
+                                       uint64_t min_version = 0,
+                                       uint32_t wait_ms = 0,
+                                       const std::vector<std::string>& servers = {});
+    
+    // Local SGD (periodic model averaging) of a model returned by register_model. The rows of
+    // inputs and targets are split evenly over the servers once and kept there. Every round, each
+    // server starts from the current model, runs local_steps optimizer steps on batches of its own
+    // rows, and sends its weights back; the trainer averages them (weighted by the rows trained on)
+    // into the model. Weights cross the network once per round rather than once per step.
+    // servers defaults to every connected remote server; Adam and AdamW use torch's default betas
+    // and epsilon. Returns the loss, time and bytes of every round.
+    py::dict train_local_sgd(py::object model,
+                             py::object inputs,
+                             py::object targets,
+                             py::object criterion,
+                             int rounds,
+                             uint32_t local_steps,
+                             uint32_t batch_size = 32,
+                             const std::vector<std::string>& servers = {},
+                             const std::string& optimizer = "sgd",
+                             float learning_rate = 0.01f,
+                             float momentum = 0.0f,
+                             float weight_decay = 0.0f,
+                             uint64_t seed = 0);
+    
+    // Asynchronous SGD: every server repeatedly computes gradients on its shard of inputs and
+    // targets against the weight version it last received, and the trainer applies them to the
+    // master weights as they arrive, with no barrier between servers, then sends that server the
+    // new weights. A gradient computed more than max_staleness versions ago is dropped
+    // (stale_policy "drop") or applied scaled by (max_staleness + 1) / (staleness + 1) ("scale").
+    // Runs until updates gradients were applied and loads the result into the model; returns the
+    // staleness seen and rejected per server and the loss of every applied update.
+    py::dict train_async_sgd(py::object model,
+                             py::object inputs,
+                             py::object targets,
+                             py::object criterion,
+                             uint64_t updates,
+                             uint32_t batch_size = 32,
+                             uint32_t max_staleness = 4,
+                             const std::string& stale_policy = "drop",
+                             const std::vector<std::string>& servers = {},
+                             const std::string& optimizer = "sgd",
+                             float learning_rate = 0.01f,
+                             float momentum = 0.0f,
+                             float weight_decay = 0.0f,
+                             uint64_t seed = 0);
 };
 
 #endif // CORE_H 
\ No newline at end of file
@@ -1,15 +1,27 @@
 #include "core.h"
 #include "distributed_model.h"
 #include "server_communication.h"
+#include "tensor_buffer.h"
+#include "metrics.h"
+#include "logging.h"
+#include "trace.h"
+#include "row_chunks.h"
+#include "parameter_server.h"
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <chrono>
+#include <functional>
+#include <random>
+#include <sstream>
 
 namespace py = pybind11;
 
 // LeafConfig implementation
-LeafConfig::LeafConfig() {
-    discover_local_resources();
+LeafConfig::LeafConfig(bool include_local) {
+    if (include_local) {
+        discover_local_resources();
+    }
 }
 
 void LeafConfig::add_server(const std::string& server_name,
@@ -21,6 +33,126 @@ void LeafConfig::add_server(const std::string& server_name,
     servers[server_name] = Server(server_name, creds, false);
 }
 
+bool LeafConfig::add_endpoint(const std::string& server_name, const std::string& address) {
+    Server server;
+    {
+        // Probing the server is an RPC
+        py::gil_scoped_release release;
+        server = Server(server_name, address);
+    }
+    bool connected = server.is_server_connected();
+    if (!connected) {
+        LEAF_LOG_WARN("Server " << server_name << " at " << address << " did not answer");
+    }
+    servers[server_name] = std::move(server);
+    return connected;
+}
+
+py::dict LeafConfig::add_servers(py::list server_specs, size_t max_parallel, py::object progress) {
+    struct ServerSpec {
+        std::string server_name;
+        std::string username;
+        std::string hostname;
+        int port;
+        std::string key_path;
+    };
+    
+    // Group specs by host; a host's servers are provisioned sequentially by one worker
+    std::vector<std::vector<ServerSpec>> hosts;
+    std::map<std::string, size_t> host_index;
+    size_t total = 0;
+    for (auto item : server_specs) {
+        py::dict spec = py::reinterpret_borrow<py::dict>(item);
+        ServerSpec server;
+        server.server_name = spec["server_name"].cast<std::string>();
+        server.username = spec["username"].cast<std::string>();
+        server.hostname = spec["hostname"].cast<std::string>();
+        server.port = spec.contains("port") ? spec["port"].cast<int>() : 22;
+        server.key_path = spec.contains("key_path") ? spec["key_path"].cast<std::string>() : "";
+        
+        std::string host = server.hostname + ":" + std::to_string(server.port);
+        auto it = host_index.find(host);
+        if (it == host_index.end()) {
+            it = host_index.emplace(host, hosts.size()).first;
+            hosts.emplace_back();
+        }
+        hosts[it->second].push_back(std::move(server));
+        total++;
+    }
+    
+    size_t workers = hosts.size();
+    if (max_parallel > 0 && max_parallel < workers) {
+        workers = max_parallel;
+    }
+    LEAF_LOG_INFO("Provisioning " << total << " servers on " << hosts.size() << " hosts with "
+                  << workers << " parallel workers...");
+    
+    // The GIL guards servers, so the workers collect theirs here and they are added once it is held
+    std::mutex result_mutex;  // Guards provisioned, results and completed
+    std::map<std::string, Server> provisioned;
+    std::map<std::string, bool> results;
+    size_t completed = 0;
+    std::atomic<size_t> next_host(0);
+    auto start = std::chrono::steady_clock::now();
+    
+    auto provision = [&]() {
+        for (size_t h = next_host++; h < hosts.size(); h = next_host++) {
+            for (const auto& spec : hosts[h]) {
+                bool connected = false;
+                Server server;
+                try {
+                    UserCredentials creds(spec.username, spec.hostname, spec.port, spec.key_path);
+                    server = Server(spec.server_name, creds, false);
+                    connected = server.is_server_connected();
+                } catch (const std::exception& e) {
+                    LEAF_LOG_ERROR("Error provisioning " << spec.server_name << ": " << e.what());
+                }
+                
+                size_t done;
+                {
+                    std::lock_guard<std::mutex> lock(result_mutex);
+                    provisioned[spec.server_name] = std::move(server);
+                    results[spec.server_name] = connected;
+                    done = ++completed;
+                }
+                auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start);
+                LEAF_LOG_INFO("[" << done << "/" << total << "] " << spec.server_name << " ("
+                              << spec.hostname << "): " << (connected ? "connected" : "failed")
+                              << " after " << elapsed.count() << "s");
+                if (!progress.is_none()) {
+                    py::gil_scoped_acquire gil;
+                    try {
+                        progress(spec.server_name, connected, done, total);
+                    } catch (const py::error_already_set& e) {
+                        LEAF_LOG_ERROR("Progress callback failed: " << e.what());
+                    }
+                }
+            }
+        }
+    };
+    
+    {
+        // Provisioning is SSH and Docker work; only the progress callback needs the GIL
+        py::gil_scoped_release release;
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < workers; ++i) {
+            threads.emplace_back(provision);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    for (auto& [name, server] : provisioned) {
+        servers[name] = std::move(server);
+    }
+    
+    py::dict connected;
+    for (const auto& [name, ok] : results) {
+        connected[py::str(name)] = ok;
+    }
+    return connected;
+}
+
 std::vector<std::string> LeafConfig::get_servers() const {
     std::vector<std::string> server_names;
     for (const auto& [name, server] : servers) {
@@ -44,6 +176,9 @@ void LeafConfig::print_server_info(const Server& server) const {
     std::cout << "Status: " << (server.is_server_connected() ? "Connected" : "Not connected") << "\n";
     if (server.is_local_server()) {
         std::cout << "Type: Local machine\n";
+    } else if (!server.get_endpoint().empty()) {
+        std::cout << "Type: Remote server\n";
+        std::cout << "Endpoint: " << server.get_endpoint() << "\n";
     } else {
         std::cout << "Type: Remote server\n";
         const UserCredentials& creds = server.get_credentials();
@@ -88,11 +223,12 @@ py::dict LeafConfig::get_server_info(const std::string& server_name) const {
         info["is_local"] = server.is_local_server();
         
         const UserCredentials& creds = server.get_credentials();
-        std::cout << "Debug: Server " << server_name << " has hostname: " << creds.get_hostname() << " and port: " << creds.get_port() << std::endl;
+        LEAF_LOG_DEBUG("Server " << server_name << " has hostname: " << creds.get_hostname() << " and port: " << creds.get_port());
         info["username"] = creds.get_username();
         info["hostname"] = creds.get_hostname();
         info["port"] = creds.get_port();
         info["key_path"] = creds.get_key_path();
+        info["endpoint"] = server.get_endpoint();
 
         py::list resources;
         for (const auto& resource : server.get_resources()) {
@@ -114,6 +250,8 @@ void LeafConfig::remove_server(const std::string& server_name) {
 }
 
 void LeafConfig::print_all_resources() const {
+    // Log lines are written in the background; let pending ones out before the report
+    log_flush();
     std::cout << "\n=== Available Servers and Resources ===\n";
     
     for (const auto& [name, server] : servers) {
@@ -123,6 +261,31 @@ void LeafConfig::print_all_resources() const {
     std::cout << "\n=== End of Server List ===\n\n";
 }
 
+void LeafConfig::refresh_resources(const std::string& server_name) {
+    // The GIL guards servers against add_server and remove_server from other Python threads, so
+    // probe copies without it and store their results once it is held again. The copies also
+    // keep the SSH tunnels open while they are probed.
+    std::vector<Server> targets;
+    for (const auto& [name, server] : servers) {
+        if (server_name.empty() || name == server_name) {
+            targets.push_back(server);
+        }
+    }
+    {
+        // Only RPCs and local probes from here on
+        py::gil_scoped_release release;
+        for (auto& server : targets) {
+            server.refresh_resources();
+        }
+    }
+    for (const auto& server : targets) {
+        auto it = servers.find(server.get_name());
+        if (it != servers.end()) {
+            it->second.set_resources(server.get_resources());
+        }
+    }
+}
+
 std::pair<int, std::string> LeafConfig::get_server_connection_info(const std::string& server_name) const {
     auto it = servers.find(server_name);
     if (it != servers.end()) {
@@ -130,6 +293,9 @@ std::pair<int, std::string> LeafConfig::get_server_connection_info(const std::st
         if (server.is_local_server()) {
             // For localhost, return -1 for PID and default gRPC port
             return {-1, "localhost:50051"};
+        } else if (!server.get_endpoint().empty()) {
+            // Registered directly, so there is no tunnel
+            return {-1, server.get_endpoint()};
         } else {
             // For remote servers, get tunnel info from credentials
             const UserCredentials& creds = server.get_credentials();
@@ -152,11 +318,31 @@ std::pair<int, std::string> LeafConfig::get_server_connection_info(const std::st
 }
 
 // LeafTrainer implementation
-LeafTrainer::LeafTrainer(const LeafConfig& cfg) : config(cfg) {
+LeafTrainer::LeafTrainer(const LeafConfig& cfg) : config(cfg), request_nonce(std::random_device()()) {
     // gRPC is automatically initialized when needed
 }
 
-LeafTrainer::~LeafTrainer() {}
+std::string LeafTrainer::new_request_id() {
+    std::ostringstream id;
+    id << std::hex << request_nonce << "-" << std::dec << request_counter++;
+    return id.str();
+}
+
+LeafTrainer::~LeafTrainer() {
+    {
+        py::gil_scoped_release release;
+        heartbeat_monitor.stop();
+    }
+    if (step_hook_handle) {
+        step_hook_handle.attr("remove")();
+    }
+    checkpoint_shares.clear();
+    if (checkpoint_writer.get_stats().submitted > 0) {
+        // The writer releases snapshot buffers under the GIL, so let it finish without holding it
+        py::gil_scoped_release release;
+        checkpoint_writer.flush(nullptr);
+    }
+}
 
 std::shared_ptr<grpc::Channel> LeafTrainer::create_channel(const std::string& server_name) {
     const auto& servers = config.get_servers();
@@ -167,7 +353,7 @@ std::shared_ptr<grpc::Channel> LeafTrainer::create_channel(const std::string& se
 
     // Get the server address using the tunnel port from user credentials
     std::string server_address = config.get_server_connection_info(server_name).second;
-    std::cout << "Creating gRPC channel for server '" << server_name << "' at address: " << server_address << std::endl;
+    LEAF_LOG_DEBUG("Creating gRPC channel for server '" << server_name << "' at address: " << server_address);
     
     // Configure channel with increased message size limits to handle large model weights
     grpc::ChannelArguments args;
@@ -185,39 +371,44 @@ std::shared_ptr<grpc::Channel> LeafTrainer::create_channel(const std::string& se
     return channel;
 }
 
-std::pair<std::vector<float>, float> LeafTrainer::get_gradients_from_server(
+std::pair<py::array_t<float>, float> LeafTrainer::get_gradients_from_server(
     const std::string& server_name,
     py::object inputs,
     py::object model,
     py::object criterion,
     py::object optimizer,
-    bool is_local) {
+    bool is_local,
+    const std::string& request_id) {
+    static RpcMetrics rpc("GetGradients");
+    static Histogram& serialize_us = metrics().histogram("gradients.serialize_us");
 
-    std::cout << "  inputs: " << py::str(inputs.get_type()) << std::endl;
-    std::cout << "  inputs repr: " << py::str(inputs) << std::endl;
+    LEAF_LOG_DEBUG("inputs: " << py::str(inputs.get_type()));
+    LEAF_LOG_DEBUG("inputs repr: " << py::str(inputs));
 
     // Extract model state from PyTorch model
+    auto serialize_start = std::chrono::steady_clock::now();
+    TraceSpan serialize_span("serialize", "trainer", server_name);
     py::object state_dict = model.attr("state_dict")();
     std::vector<float> model_state;
 
     // Convert state dict to flat vector
-    std::cout << "  state_dict type: " << py::str(state_dict.get_type()) << std::endl;
-    std::cout << "  state_dict repr: " << py::str(state_dict) << std::endl;
+    LEAF_LOG_DEBUG("state_dict type: " << py::str(state_dict.get_type()));
+    LEAF_LOG_TRACE("state_dict repr: " << py::str(state_dict));
     
     // Iterate over the state dict items properly
     py::object items = state_dict.attr("items")();
-    std::cout << "  items type: " << py::str(items.get_type()) << std::endl;
-    std::cout << "  items repr: " << py::str(items) << std::endl;
+    LEAF_LOG_TRACE("items type: " << py::str(items.get_type()));
+    LEAF_LOG_TRACE("items repr: " << py::str(items));
     
-    std::cout << "before loop" << std::endl;
+    LEAF_LOG_TRACE("Iterating over state dict items");
     try {
         for (auto item : items) {
-            std::cout << "  Item type: " << py::str(item.get_type()) << std::endl;
-            std::cout << "  Item repr: " << py::str(item) << std::endl;
+            LEAF_LOG_TRACE("Item type: " << py::str(item.get_type()));
+            LEAF_LOG_TRACE("Item repr: " << py::str(item));
 
             // Extract the tensor value from the key-value pair
             py::object tensor = item.attr("__getitem__")(1);  // Get the value (tensor) from the key-value pair
-            std::cout << "  Tensor type: " << py::str(tensor.get_type()) << std::endl;
+            LEAF_LOG_TRACE("Tensor type: " << py::str(tensor.get_type()));
             
             // Check if tensor has cpu() method
             if (py::hasattr(tensor, "cpu")) {
@@ -229,37 +420,39 @@ std::pair<std::vector<float>, float> LeafTrainer::get_gradients_from_server(
                         model_state.push_back(buffer[i]);
                     }
                 } else {
-                    std::cout << "  Warning: CPU tensor does not have numpy() method" << std::endl;
+                    LEAF_LOG_WARN("CPU tensor does not have numpy() method");
                 }
             } else {
-                std::cout << "  Warning: Tensor does not have cpu() method" << std::endl;
+                LEAF_LOG_WARN("Tensor does not have cpu() method");
             }
         }
     } catch (const std::exception& e) {
-        std::cout << "  Error during state dict iteration: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error during state dict iteration: " << e.what());
         throw;
     }
     
     // Extract input data
-    std::cout << "  inputs type: " << py::str(inputs.get_type()) << std::endl;
-    std::cout << "  inputs repr: " << py::str(inputs) << std::endl;
+    LEAF_LOG_DEBUG("inputs type: " << py::str(inputs.get_type()));
+    LEAF_LOG_DEBUG("inputs repr: " << py::str(inputs));
     py::array_t<float> inputs_array = inputs.attr("cpu")().attr("numpy")();
     auto inputs_buffer = inputs_array.unchecked<1>();
     std::vector<float> input_data;
     for (py::ssize_t i = 0; i < inputs_buffer.size(); ++i) {
         input_data.push_back(inputs_buffer[i]);
     }
+    serialize_us.record(microseconds_since(serialize_start));
+    serialize_span.finish();
     
     if (is_local) {
         // For local servers, directly use the GetGradients function from server_communication.cpp
-        std::cout << "  Computing gradients locally (using GetGradients from server_communication)..." << std::endl;
+        LEAF_LOG_DEBUG("Computing gradients locally (using GetGradients from server_communication)...");
         
         // Create an instance of ServerCommunicationServiceImpl to use its GetGradients method
         ServerCommunicationServiceImpl service;
         
         // Create the request and response objects
         leaftest::GradientRequest request;
-        leaftest::GradientResponse response;
+        auto response = std::make_unique<leaftest::GradientResponse>();
         
         // Set the request data
         request.set_model_state(model_state.data(), model_state.size() * sizeof(float));
@@ -267,25 +460,23 @@ std::pair<std::vector<float>, float> LeafTrainer::get_gradients_from_server(
         
         // Call the GetGradients method directly
         grpc::ServerContext context;
-        auto status = service.GetGradients(&context, &request, &response);
+        auto status = service.GetGradients(&context, &request, response.get());
         
         if (!status.ok()) {
             throw std::runtime_error("Local GetGradients failed: " + status.error_message());
         }
         
-        if (!response.success()) {
-            throw std::runtime_error("Local GetGradients failed: " + response.error_message());
+        if (!response->success()) {
+            throw std::runtime_error("Local GetGradients failed: " + response->error_message());
         }
         
-        // Parse gradients from response
-        std::vector<float> gradients;
-        const std::string& gradients_data = response.gradients();
-        size_t num_gradients = gradients_data.size() / sizeof(float);
-        gradients.resize(num_gradients);
-        std::memcpy(gradients.data(), gradients_data.data(), gradients_data.size());
+        // Hand the response buffer to numpy instead of copying the gradients out of it
+        float loss = response->loss();
+        std::string* gradients_data = response->mutable_gradients();
+        py::array_t<float> gradients = wrap_message_floats(std::move(response), gradients_data);
         
-        std::cout << "  Local computation completed" << std::endl;
-        return {gradients, response.loss()};
+        LEAF_LOG_DEBUG("Local computation completed");
+        return {gradients, loss};
     }
     
     std::lock_guard<std::mutex> lock(channel_mutex);
@@ -302,36 +493,56 @@ std::pair<std::vector<float>, float> LeafTrainer::get_gradients_from_server(
     leaftest::GradientRequest request;
     request.set_model_state(model_state.data(), model_state.size() * sizeof(float));
     request.set_input_data(input_data.data(), input_data.size() * sizeof(float));
+    request.set_request_id(request_id);
+    request.set_trace(tracer().is_enabled());
     
     // Make RPC call
+    if (!heartbeat_monitor.is_alive(server_name)) {
+        throw std::runtime_error("Server " + server_name + " stopped sending heartbeats");
+    }
     grpc::ClientContext context;
-    leaftest::GradientResponse response;
+    auto response = std::make_unique<leaftest::GradientResponse>();
     
-    auto status = stub->GetGradients(&context, request, &response);
+    grpc::Status status;
+    int64_t rpc_start_us = trace_now_us();
+    {
+        HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+        ScopedTimer timer(rpc.latency_us);
+        status = stub->GetGradients(&context, request, response.get());
+    }
+    tracer().record_rpc("GetGradients", server_name, rpc_start_us, trace_now_us(), response->trace_events());
+    rpc.bytes_out.add(request.ByteSizeLong());
+    rpc.bytes_in.add(response->ByteSizeLong());
+    if (!status.ok() || !response->success()) {
+        rpc.failures.add();
+    }
     
     if (!status.ok()) {
+        if (!heartbeat_monitor.is_alive(server_name)) {
+            throw std::runtime_error("Server " + server_name + " stopped sending heartbeats");
+        }
         throw std::runtime_error("RPC failed for server " + server_name + ": " + status.error_message());
     }
     
-    if (!response.success()) {
-        throw std::runtime_error("Server " + server_name + " failed: " + response.error_message());
+    if (!response->success()) {
+        throw std::runtime_error("Server " + server_name + " failed: " + response->error_message());
     }
     
-    // Parse gradients from response
-    std::vector<float> gradients;
-    const std::string& gradients_data = response.gradients();
-    size_t num_gradients = gradients_data.size() / sizeof(float);
-    gradients.resize(num_gradients);
-    std::memcpy(gradients.data(), gradients_data.data(), gradients_data.size());
-    
-    return {gradients, response.loss()};
+    // Hand the response buffer to numpy instead of copying the gradients out of it
+    float loss = response->loss();
+    std::string* gradients_data = response->mutable_gradients();
+    return {wrap_message_floats(std::move(response), gradients_data), loss};
 }
 
 py::object LeafTrainer::forward_pass_on_server(
     const std::string& server_name,
     py::object inputs,
     uint32_t model_index,
-    bool is_local) {
+    bool is_local,
+    const std::string& request_id) {
+    static RpcMetrics rpc("ForwardPass");
+    static Histogram& serialize_us = metrics().histogram("forward.serialize_us");
+    static Histogram& deserialize_us = metrics().histogram("forward.deserialize_us");
     
     try {
         if (is_local) {
@@ -368,6 +579,8 @@ py::object LeafTrainer::forward_pass_on_server(
         py::object numpy = py::module_::import("numpy");
         
         // Convert input to numpy array
+        auto serialize_start = std::chrono::steady_clock::now();
+        TraceSpan serialize_span("serialize", "trainer", server_name);
         py::array_t<float> input_array;
         if (py::hasattr(inputs, "cpu")) {
             py::object cpu_input = inputs.attr("cpu")();
@@ -379,95 +592,118 @@ py::object LeafTrainer::forward_pass_on_server(
         } else {
             throw std::runtime_error("Input tensor does not have cpu() method");
         }
-        // Flatten to 1D contiguous array
-        py::object flat_obj = numpy.attr("ascontiguousarray")(input_array).attr("ravel")();
-        py::array_t<float> flat_array = flat_obj.cast<py::array_t<float>>();
-        
-        // Check input size and split into chunks if too large
-        size_t input_size = flat_array.size() * sizeof(float);
-        std::cout << "ForwardPass: Input array size: " << input_size << " bytes (" << flat_array.size() << " elements)" << std::endl;
-        
-        const size_t max_chunk_bytes = 32 * 1024; // 32KB - reasonable chunk size
-        const size_t max_chunk_elems = max_chunk_bytes / sizeof(float);
-        std::vector<py::array_t<float>> input_chunks;
-        if (flat_array.size() > max_chunk_elems) {
-            std::cout << "ForwardPass: Input is large, splitting into chunks of " << max_chunk_elems << " elements each" << std::endl;
-            size_t num_chunks = (flat_array.size() + max_chunk_elems - 1) / max_chunk_elems;
-            auto input_buffer = flat_array.unchecked<1>();
-            for (size_t i = 0; i < num_chunks; ++i) {
-                size_t start = i * max_chunk_elems;
-                size_t end = std::min(start + max_chunk_elems, (size_t)flat_array.size());
-                size_t chunk_size = end - start;
-                py::array_t<float> chunk_array({(py::ssize_t)chunk_size});
-                auto chunk_buffer = chunk_array.mutable_unchecked<1>();
-                for (size_t j = 0; j < chunk_size; ++j) {
-                    chunk_buffer[j] = input_buffer[start + j];
-                }
-                input_chunks.push_back(chunk_array);
-            }
-        } else {
-            input_chunks.push_back(flat_array);
+        // Make sure rows are contiguous so each chunk is a plain byte range of the input
+        py::array_t<float, py::array::c_style> contiguous_array = numpy.attr("ascontiguousarray")(input_array);
+        if (contiguous_array.ndim() == 0) {
+            contiguous_array = numpy.attr("reshape")(contiguous_array, py::make_tuple(1, 1));
+        } else if (contiguous_array.ndim() == 1) {
+            contiguous_array = numpy.attr("reshape")(contiguous_array, py::make_tuple(1, contiguous_array.shape(0)));
+        }
+        serialize_us.record(microseconds_since(serialize_start));
+        serialize_span.finish();
+        
+        // Split along the batch dimension so every chunk holds whole samples and its outputs
+        // can be concatenated back in order
+        size_t num_rows = static_cast<size_t>(contiguous_array.shape(0));
+        size_t row_elems = num_rows > 0 ? static_cast<size_t>(contiguous_array.size()) / num_rows : 0;
+        size_t input_size = contiguous_array.size() * sizeof(float);
+        LEAF_LOG_DEBUG("ForwardPass: Input array size: " << input_size << " bytes (" << num_rows << " samples)");
+        
+        RowChunks chunks = plan_row_chunks(num_rows, row_elems);
+        size_t rows_per_chunk = chunks.rows_per_chunk;
+        size_t num_chunks = chunks.num_chunks;
+        if (num_chunks > 1) {
+            LEAF_LOG_DEBUG("ForwardPass: Input is large, splitting into chunks of " << rows_per_chunk << " samples each");
         }
+        const float* input_data = contiguous_array.data();
         
         // Run forward pass for each chunk and collect outputs
         py::list outputs;
-        for (size_t chunk_idx = 0; chunk_idx < input_chunks.size(); ++chunk_idx) {
-            const auto& chunk_array = input_chunks[chunk_idx];
-            std::cout << "ForwardPass: Processing chunk " << (chunk_idx + 1) << "/" << input_chunks.size() << std::endl;
+        for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            size_t start_row = chunk_idx * rows_per_chunk;
+            size_t chunk_rows = std::min(rows_per_chunk, num_rows - start_row);
+            const float* chunk_data = input_data + start_row * row_elems;
+            size_t chunk_bytes = chunk_rows * row_elems * sizeof(float);
+            LEAF_LOG_DEBUG("ForwardPass: Processing chunk " << (chunk_idx + 1) << "/" << num_chunks);
             
             // Retry logic for RPC calls
             const int max_retries = 3;
             bool success = false;
             std::string last_error;
+            std::unique_ptr<leaftest::ForwardPassResponse> response;
             
             for (int retry = 0; retry < max_retries && !success; ++retry) {
+                // Retrying a server that stopped sending heartbeats would only wait out more deadlines
+                if (!heartbeat_monitor.is_alive(server_name)) {
+                    last_error = "server stopped sending heartbeats";
+                    break;
+                }
                 try {
-                    // Use the numpy array directly for the request
+                    // Send the chunk's rows straight from the input buffer along with their shape
                     leaftest::ForwardPassRequest request;
-                    request.set_input_data(chunk_array.data(), chunk_array.size() * sizeof(float));
+                    request.set_input_data(chunk_data, chunk_bytes);
+                    request.add_input_shape(static_cast<int64_t>(chunk_rows));
+                    for (py::ssize_t dim = 1; dim < contiguous_array.ndim(); ++dim) {
+                        request.add_input_shape(contiguous_array.shape(dim));
+                    }
                     request.set_model_index(model_index);
+                    if (!request_id.empty()) {
+                        request.set_request_id(chunk_request_id(request_id, chunk_idx));
+                    }
+                    request.set_trace(tracer().is_enabled());
                     
                     grpc::ClientContext context;
                     std::chrono::system_clock::time_point deadline = 
                         std::chrono::system_clock::now() + std::chrono::seconds(60); // Longer timeout
                     context.set_deadline(deadline);
                     
-                    std::cout << "ForwardPass: Making RPC call to server " << server_name << " (attempt " << (retry + 1) << "/" << max_retries << ")" << std::endl;
-                    std::cout << "ForwardPass: Chunk size: " << chunk_array.size() * sizeof(float) << " bytes" << std::endl;
+                    LEAF_LOG_DEBUG("ForwardPass: Making RPC call to server " << server_name << " (attempt " << (retry + 1) << "/" << max_retries << ")");
+                    LEAF_LOG_DEBUG("ForwardPass: Chunk size: " << chunk_bytes << " bytes");
                     
-                    leaftest::ForwardPassResponse response;
-                    auto status = stub->ForwardPass(&context, request, &response);
+                    response = std::make_unique<leaftest::ForwardPassResponse>();
+                    grpc::Status status;
+                    int64_t rpc_start_us = trace_now_us();
+                    {
+                        HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+                        ScopedTimer timer(rpc.latency_us);
+                        status = stub->ForwardPass(&context, request, response.get());
+                    }
+                    tracer().record_rpc("ForwardPass", server_name, rpc_start_us, trace_now_us(), response->trace_events());
+                    rpc.bytes_out.add(request.ByteSizeLong());
+                    rpc.bytes_in.add(response->ByteSizeLong());
+                    if (!status.ok() || !response->success()) {
+                        rpc.failures.add();
+                    }
                     
                     if (!status.ok()) {
-                        std::cout << "ForwardPass: RPC failed with error code: " << status.error_code() << std::endl;
-                        std::cout << "ForwardPass: Error message: " << status.error_message() << std::endl;
-                        std::cout << "ForwardPass: Error details: " << status.error_details() << std::endl;
+                        LEAF_LOG_WARN("ForwardPass: RPC failed with error code " << status.error_code() << ": "
+                                      << status.error_message() << " (" << status.error_details() << ")");
                         last_error = "RPC failed: " + status.error_message();
                         
                         if (retry < max_retries - 1) {
-                            std::cout << "ForwardPass: Retrying in 1 second..." << std::endl;
+                            LEAF_LOG_INFO("ForwardPass: Retrying in 1 second...");
                             std::this_thread::sleep_for(std::chrono::seconds(1));
                             continue;
                         }
-                    } else if (!response.success()) {
-                        std::cout << "ForwardPass: Server returned success=false" << std::endl;
-                        last_error = "Server failed: " + response.error_message();
+                    } else if (!response->success()) {
+                        LEAF_LOG_WARN("ForwardPass: Server returned success=false: " << response->error_message());
+                        last_error = "Server failed: " + response->error_message();
                         
                         if (retry < max_retries - 1) {
-                            std::cout << "ForwardPass: Retrying in 1 second..." << std::endl;
+                            LEAF_LOG_INFO("ForwardPass: Retrying in 1 second...");
                             std::this_thread::sleep_for(std::chrono::seconds(1));
                             continue;
                         }
                     } else {
                         success = true;
-                        std::cout << "ForwardPass: Chunk " << (chunk_idx + 1) << " successful" << std::endl;
+                        LEAF_LOG_DEBUG("ForwardPass: Chunk " << (chunk_idx + 1) << " successful");
                     }
                 } catch (const std::exception& e) {
                     last_error = "Exception: " + std::string(e.what());
-                    std::cout << "ForwardPass: Exception on attempt " << (retry + 1) << ": " << e.what() << std::endl;
+                    LEAF_LOG_WARN("ForwardPass: Exception on attempt " << (retry + 1) << ": " << e.what());
                     
                     if (retry < max_retries - 1) {
-                        std::cout << "ForwardPass: Retrying in 1 second..." << std::endl;
+                        LEAF_LOG_INFO("ForwardPass: Retrying in 1 second...");
                         std::this_thread::sleep_for(std::chrono::seconds(1));
                         continue;
                     }
@@ -478,15 +714,29 @@ py::object LeafTrainer::forward_pass_on_server(
                 throw std::runtime_error("Forward pass failed for chunk " + std::to_string(chunk_idx + 1) + " after " + std::to_string(max_retries) + " attempts. Last error: " + last_error);
             }
             
-            // For now, append a dummy tensor for each chunk
-            outputs.append(torch.attr("randn")(1, 10));
+            if (response->output_dtype() != "float32") {
+                throw std::runtime_error("Unsupported output dtype '" + response->output_dtype() + "' for chunk " + std::to_string(chunk_idx + 1));
+            }
+            
+            // Wrap the response's output bytes as a tensor without copying; the tensor keeps the response alive
+            {
+                ScopedTimer timer(deserialize_us);
+                TraceSpan span("deserialize", "trainer", server_name);
+                std::vector<py::ssize_t> output_shape(response->output_shape().begin(), response->output_shape().end());
+                std::string* output_data = response->mutable_output_data();
+                py::array_t<float> output_array = wrap_message_floats(std::move(response), output_data, output_shape);
+                outputs.append(torch.attr("from_numpy")(output_array));
+            }
             
             // Add delay between chunks to prevent overwhelming the server
-            if (chunk_idx < input_chunks.size() - 1) {
+            if (chunk_idx < num_chunks - 1) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
             }
         }
-        // Concatenate outputs along batch dimension
+        // Concatenate outputs along batch dimension in chunk order
+        if (outputs.size() == 1) {
+            return outputs[0];
+        }
         return torch.attr("cat")(outputs, 0);
         
     } catch (const std::exception& e) {
@@ -500,9 +750,20 @@ std::vector<std::pair<std::string, std::vector<size_t>>> LeafTrainer::distribute
     
     std::vector<std::pair<std::string, std::vector<size_t>>> distribution;
     
+    // Leave out servers that stopped sending heartbeats, unless that would leave none
+    std::vector<std::string> live_servers;
+    for (const auto& server : server_names) {
+        if (heartbeat_monitor.is_alive(server)) {
+            live_servers.push_back(server);
+        }
+    }
+    if (live_servers.empty()) {
+        live_servers = server_names;
+    }
+    
     // Simple round-robin distribution
     for (size_t i = 0; i < batch_size; ++i) {
-        std::string server = server_names[i % server_names.size()];
+        std::string server = live_servers[i % live_servers.size()];
         
         // Find if this server is already in distribution
         auto it = std::find_if(distribution.begin(), distribution.end(),
@@ -520,10 +781,10 @@ std::vector<std::pair<std::string, std::vector<size_t>>> LeafTrainer::distribute
 
 void LeafTrainer::cleanup_models() {
     std::lock_guard<std::mutex> lock(models_mutex);
-    std::cout << "Cleaning up " << local_models.size() << " local models..." << std::endl;
+    LEAF_LOG_INFO("Cleaning up " << local_models.size() << " local models...");
     local_models.clear();
     distributed_models.clear();
-    std::cout << "Model cleanup completed." << std::endl;
+    LEAF_LOG_INFO("Model cleanup completed.");
 }
 
 size_t LeafTrainer::get_model_count() const {
@@ -543,6 +804,7 @@ std::pair<bool, std::string> LeafTrainer::store_model_weights_on_server(
     const std::string& server_name,
     const std::vector<float>& model_state,
     const std::string& model_id) {
+    static RpcMetrics rpc("StoreModelWeights");
     
     try {
         std::lock_guard<std::mutex> lock(channel_mutex);
@@ -564,7 +826,16 @@ std::pair<bool, std::string> LeafTrainer::store_model_weights_on_server(
         grpc::ClientContext context;
         leaftest::StoreModelWeightsResponse response;
         
-        auto status = stub->StoreModelWeights(&context, request, &response);
+        grpc::Status status;
+        {
+            ScopedTimer timer(rpc.latency_us);
+            status = stub->StoreModelWeights(&context, request, &response);
+        }
+        rpc.bytes_out.add(request.ByteSizeLong());
+        rpc.bytes_in.add(response.ByteSizeLong());
+        if (!status.ok() || !response.success()) {
+            rpc.failures.add();
+        }
         
         if (!status.ok()) {
             return {false, "RPC failed: " + status.error_message()};
@@ -581,7 +852,7 @@ std::pair<bool, std::string> LeafTrainer::store_model_weights_on_server(
 }
 
 py::object LeafTrainer::register_model(py::object model) {
-    std::cout << "Registering model with LeafTrainer..." << std::endl;
+    LEAF_LOG_INFO("Registering model with LeafTrainer...");
     // Create a Model instance that wraps the PyTorch model using smart pointer
     auto leaf_model = std::make_shared<Model>(model, this);
     
@@ -595,26 +866,36 @@ py::object LeafTrainer::register_model(py::object model) {
     
     // Extract model state from PyTorch model using the new serialize_state method
     std::vector<float> model_state = leaf_model->serialize_state();
-    std::cout << "Model state extracted, size: " << model_state.size() << " parameters" << std::endl;
+    LEAF_LOG_INFO("Model state extracted, size: " << model_state.size() << " parameters");
+    
+    // Serialize the module with torch.save for servers that need to rebuild it
+    std::string model_definition;
+    {
+        py::object torch = py::module_::import("torch");
+        py::object io = py::module_::import("io");
+        py::object buffer = io.attr("BytesIO")();
+        torch.attr("save")(model, buffer);
+        model_definition = buffer.attr("getvalue")().cast<std::string>();
+    }
     
     // Distribute model to all servers
     auto server_names = config.get_servers();
-    std::cout << "Distributing model to " << server_names.size() << " servers..." << std::endl;
+    LEAF_LOG_INFO("Distributing model to " << server_names.size() << " servers...");
     for (const auto& server_name : server_names) {
         try {
             py::dict server_info = config.get_server_info(server_name);
             bool is_local = server_info["is_local"].cast<bool>();
             bool is_connected = server_info["connected"].cast<bool>();
             if (!is_connected) {
-                std::cout << "Skipping server " << server_name << " - not connected" << std::endl;
+                LEAF_LOG_INFO("Skipping server " << server_name << " - not connected");
                 continue;
             }
-            std::cout << "Storing model on server: " << server_name << std::endl;
+            LEAF_LOG_INFO("Storing model on server: " << server_name);
             if (is_local) {
                 ServerCommunicationServiceImpl service;
                 std::string model_key = "model_" + std::to_string(model_index);
                 service.store_model(model_key, leaf_model);
-                std::cout << "✓ Model stored locally successfully" << std::endl;
+                LEAF_LOG_INFO("✓ Model stored locally successfully");
             } else {
                 std::lock_guard<std::mutex> lock(channel_mutex);
                 if (server_channels.find(server_name) == server_channels.end()) {
@@ -623,21 +904,22 @@ py::object LeafTrainer::register_model(py::object model) {
                 auto channel = server_channels[server_name];
                 auto stub = leaftest::ServerCommunication::NewStub(channel);
                 leaftest::StoreModelWeightsRequest request;
-                request.set_model_state(model_state.data(), model_state.size() * sizeof(float));
                 request.set_model_id("model_" + std::to_string(model_index));
+                // Ship the whole module (architecture and weights) so the server can run forward passes
+                request.set_model_definition(model_definition);
                 grpc::ClientContext context;
                 leaftest::StoreModelWeightsResponse response;
                 auto status = stub->StoreModelWeights(&context, request, &response);
                 if (!status.ok()) {
-                    std::cout << "Warning: RPC failed for server " << server_name << ": " << status.error_message() << std::endl;
+                    LEAF_LOG_WARN("RPC failed for server " << server_name << ": " << status.error_message());
                 } else if (!response.success()) {
-                    std::cout << "Warning: Server " << server_name << " failed: " << response.error_message() << std::endl;
+                    LEAF_LOG_WARN("Server " << server_name << " failed: " << response.error_message());
                 } else {
-                    std::cout << "✓ Model stored on server " << server_name << " successfully" << std::endl;
+                    LEAF_LOG_INFO("✓ Model stored on server " << server_name << " successfully");
                 }
             }
         } catch (const std::exception& e) {
-            std::cout << "Warning: Error storing model on server " << server_name << ": " << e.what() << std::endl;
+            LEAF_LOG_WARN("Error storing model on server " << server_name << ": " << e.what());
         }
     }
     
@@ -649,17 +931,29 @@ py::object LeafTrainer::register_model(py::object model) {
         distributed_models.push_back(dist_model);
     }
     py::object model_obj = py::cast(dist_model);
-    std::cout << "Model registered successfully! Total models: " << local_models.size() << std::endl;
+    LEAF_LOG_INFO("Model registered successfully! Total models: " << local_models.size());
     return model_obj;
 }
 
+// The first few values, e.g. "0.1, 0.2, 0.3, 0.4, 0.5, ..."
+static std::string sample_values(const float* data, size_t count) {
+    std::ostringstream text;
+    for (size_t i = 0; i < std::min(size_t(5), count); ++i) {
+        text << (i > 0 ? ", " : "") << data[i];
+    }
+    if (count > 5) {
+        text << ", ...";
+    }
+    return text.str();
+}
+
 py::dict LeafTrainer::train(py::object model, 
     py::object optimizer, 
     py::object train_loader, 
     int epochs,
     py::object criterion) {        
     
-    std::cout << "=== Testing get_gradients_from_server function ===" << std::endl;
+    LEAF_LOG_INFO("=== Testing get_gradients_from_server function ===");
     
     // Get available servers
     auto server_names = config.get_servers();
@@ -669,9 +963,9 @@ py::dict LeafTrainer::train(py::object model,
     py::list server_results;
     
     for (const auto& server_name : server_names) {
-        std::cout << "\n" << std::string(60, '=') << std::endl;
-        std::cout << "Testing server: " << server_name << std::endl;
-        std::cout << std::string(60, '=') << std::endl;
+        LEAF_LOG_INFO(std::string(60, '='));
+        LEAF_LOG_INFO("Testing server: " << server_name);
+        LEAF_LOG_INFO(std::string(60, '='));
         
         py::dict server_result;
         server_result["server_name"] = server_name;
@@ -682,75 +976,74 @@ py::dict LeafTrainer::train(py::object model,
             bool is_local = server_info["is_local"].cast<bool>();
             bool is_connected = server_info["connected"].cast<bool>();
             
-            std::cout << "Server type: " << (is_local ? "Local" : "Remote") << std::endl;
-            std::cout << "Connection status: " << (is_connected ? "Connected" : "Not connected") << std::endl;
+            LEAF_LOG_INFO("Server type: " << (is_local ? "Local" : "Remote"));
+            LEAF_LOG_INFO("Connection status: " << (is_connected ? "Connected" : "Not connected"));
             
             server_result["is_local"] = is_local;
             server_result["is_connected"] = is_connected;
             
             if (!is_connected) {
-                std::cout << "Skipping server " << server_name << " - not connected" << std::endl;
+                LEAF_LOG_INFO("Skipping server " << server_name << " - not connected");
                 server_result["success"] = false;
                 server_result["error"] = "Server not connected";
                 server_results.append(server_result);
                 continue;
             }
             
-            std::cout << "Getting sample batch from train loader..." << std::endl;
+            LEAF_LOG_INFO("Getting sample batch from train loader...");
             
             // Get a sample batch from the train loader for testing
             py::object train_iter = train_loader.attr("__iter__")();
-            std::cout << "Created train iterator" << std::endl;
+            LEAF_LOG_INFO("Created train iterator");
             
-            py::tuple batch = train_iter.attr("__next__")();
-            std::cout << "Got batch from iterator" << std::endl;
+            py::tuple batch;
+            {
+                TraceSpan span("batch fetch", "trainer", server_name);
+                batch = train_iter.attr("__next__")();
+            }
+            LEAF_LOG_INFO("Got batch from iterator");
             
             py::object inputs = batch[0];
             py::object targets = batch[1];
-            std::cout << "Extracted inputs and targets from batch" << std::endl;
+            LEAF_LOG_INFO("Extracted inputs and targets from batch");
             
-            std::pair<std::vector<float>, float> result;
+            std::pair<py::array_t<float>, float> result;
             
-            std::cout << "Calling get_gradients_from_server..." << std::endl;
+            // The backward step releases the output the model's last forward pass left on the server
+            std::string request_id;
+            if (py::isinstance<DistributedModel>(model)) {
+                request_id = model.cast<std::shared_ptr<DistributedModel>>()->get_last_request_id();
+            }
+            
+            LEAF_LOG_INFO("Calling get_gradients_from_server...");
             result = get_gradients_from_server(server_name,
                 inputs,
                 model,
                 criterion,
                 optimizer,
-                is_local);
+                is_local,
+                request_id);
 
             // Print results
-            std::cout << "✓ Gradient computation successful!" << std::endl;
-            std::cout << "  Loss: " << result.second << std::endl;
-            std::cout << "  Gradients size: " << result.first.size() << " elements" << std::endl;
+            LEAF_LOG_INFO("✓ Gradient computation successful!");
+            LEAF_LOG_INFO("Loss: " << result.second);
+            LEAF_LOG_INFO("Gradients size: " << result.first.size() << " elements");
             
             // Print first few gradients as a sample
-            std::cout << "  Sample gradients: ";
-            for (size_t i = 0; i < std::min(size_t(5), result.first.size()); ++i) {
-                std::cout << result.first[i];
-                if (i < std::min(size_t(4), result.first.size() - 1)) {
-                    std::cout << ", ";
-                }
-            }
-            if (result.first.size() > 5) {
-                std::cout << ", ...";
-            }
-            std::cout << std::endl;
+            size_t num_gradients = static_cast<size_t>(result.first.size());
+            const float* gradients_data = result.first.data();
+            LEAF_LOG_INFO("Sample gradients: " << sample_values(gradients_data, num_gradients));
             
             // Store results
             server_result["success"] = true;
             server_result["loss"] = result.second;
-            server_result["gradients_size"] = result.first.size();
+            server_result["gradients_size"] = num_gradients;
             
-            // Convert gradients to Python list
-            py::list gradients_list;
-            for (const auto& grad : result.first) {
-                gradients_list.append(grad);
-            }
-            server_result["gradients"] = gradients_list;
+            // Gradients are returned as a numpy array that owns the response buffer (no per-element copy)
+            server_result["gradients"] = result.first;
             
         } catch (const std::exception& e) {
-            std::cout << "✗ Error testing server " << server_name << ": " << e.what() << std::endl;
+            LEAF_LOG_ERROR("✗ Error testing server " << server_name << ": " << e.what());
             server_result["success"] = false;
             server_result["error"] = e.what();
         }
@@ -758,9 +1051,9 @@ py::dict LeafTrainer::train(py::object model,
         server_results.append(server_result);
     }
     
-    std::cout << "\n" << std::string(60, '=') << std::endl;
-    std::cout << "Gradient testing completed!" << std::endl;
-    std::cout << std::string(60, '=') << std::endl;
+    LEAF_LOG_INFO(std::string(60, '='));
+    LEAF_LOG_INFO("Gradient testing completed!");
+    LEAF_LOG_INFO(std::string(60, '='));
     
     // Return results
     results["server_results"] = server_results;
@@ -769,7 +1062,7 @@ py::dict LeafTrainer::train(py::object model,
 }
 
 py::dict LeafTrainer::test_with_hardcoded_values() {
-    std::cout << "=== Testing get_gradients_from_server with hardcoded values ===" << std::endl;
+    LEAF_LOG_INFO("=== Testing get_gradients_from_server with hardcoded values ===");
     
     // Get available servers
     auto server_names = config.get_servers();
@@ -819,9 +1112,9 @@ py::dict LeafTrainer::test_with_hardcoded_values() {
     };
     
     for (const auto& server_name : server_names) {
-        std::cout << "\n" << std::string(60, '=') << std::endl;
-        std::cout << "Testing server: " << server_name << std::endl;
-        std::cout << std::string(60, '=') << std::endl;
+        LEAF_LOG_INFO(std::string(60, '='));
+        LEAF_LOG_INFO("Testing server: " << server_name);
+        LEAF_LOG_INFO(std::string(60, '='));
         
         py::dict server_result;
         server_result["server_name"] = server_name;
@@ -832,32 +1125,32 @@ py::dict LeafTrainer::test_with_hardcoded_values() {
             bool is_local = server_info["is_local"].cast<bool>();
             bool is_connected = server_info["connected"].cast<bool>();
             
-            std::cout << "Server type: " << (is_local ? "Local" : "Remote") << std::endl;
-            std::cout << "Connection status: " << (is_connected ? "Connected" : "Not connected") << std::endl;
+            LEAF_LOG_INFO("Server type: " << (is_local ? "Local" : "Remote"));
+            LEAF_LOG_INFO("Connection status: " << (is_connected ? "Connected" : "Not connected"));
             
             server_result["is_local"] = is_local;
             server_result["is_connected"] = is_connected;
             
             if (!is_connected) {
-                std::cout << "Skipping server " << server_name << " - not connected" << std::endl;
+                LEAF_LOG_INFO("Skipping server " << server_name << " - not connected");
                 server_result["success"] = false;
                 server_result["error"] = "Server not connected";
                 server_results.append(server_result);
                 continue;
             }
             
-            std::pair<std::vector<float>, float> result;
+            std::pair<py::array_t<float>, float> result;
             
             if (is_local) {
                 // For local servers, directly use the GetGradients function from server_communication.cpp
-                std::cout << "  Computing gradients locally (using GetGradients from server_communication)..." << std::endl;
+                LEAF_LOG_DEBUG("Computing gradients locally (using GetGradients from server_communication)...");
                 
                 // Create an instance of ServerCommunicationServiceImpl to use its GetGradients method
                 ServerCommunicationServiceImpl service;
                 
                 // Create the request and response objects
                 leaftest::GradientRequest request;
-                leaftest::GradientResponse response;
+                auto response = std::make_unique<leaftest::GradientResponse>();
                 
                 // Set the request data
                 request.set_model_state(model_state.data(), model_state.size() * sizeof(float));
@@ -865,25 +1158,21 @@ py::dict LeafTrainer::test_with_hardcoded_values() {
                 
                 // Call the GetGradients method directly
                 grpc::ServerContext context;
-                auto status = service.GetGradients(&context, &request, &response);
+                auto status = service.GetGradients(&context, &request, response.get());
                 
                 if (!status.ok()) {
                     throw std::runtime_error("Local GetGradients failed: " + status.error_message());
                 }
                 
-                if (!response.success()) {
-                    throw std::runtime_error("Local GetGradients failed: " + response.error_message());
+                if (!response->success()) {
+                    throw std::runtime_error("Local GetGradients failed: " + response->error_message());
                 }
                 
-                // Parse gradients from response
-                std::vector<float> gradients;
-                const std::string& gradients_data = response.gradients();
-                size_t num_gradients = gradients_data.size() / sizeof(float);
-                gradients.resize(num_gradients);
-                std::memcpy(gradients.data(), gradients_data.data(), gradients_data.size());
-                
-                result = {gradients, response.loss()};
-                std::cout << "  Local computation completed" << std::endl;
+                // Hand the response buffer to numpy instead of copying the gradients out of it
+                float loss = response->loss();
+                std::string* gradients_data = response->mutable_gradients();
+                result = {wrap_message_floats(std::move(response), gradients_data), loss};
+                LEAF_LOG_DEBUG("Local computation completed");
             } else {
                 std::lock_guard<std::mutex> lock(channel_mutex);
                 
@@ -902,60 +1191,44 @@ py::dict LeafTrainer::test_with_hardcoded_values() {
                 
                 // Make RPC call
                 grpc::ClientContext context;
-                leaftest::GradientResponse response;
+                auto response = std::make_unique<leaftest::GradientResponse>();
                 
-                auto status = stub->GetGradients(&context, request, &response);
+                auto status = stub->GetGradients(&context, request, response.get());
                 
                 if (!status.ok()) {
                     throw std::runtime_error("RPC failed for server " + server_name + ": " + status.error_message());
                 }
                 
-                if (!response.success()) {
-                    throw std::runtime_error("Server " + server_name + " failed: " + response.error_message());
+                if (!response->success()) {
+                    throw std::runtime_error("Server " + server_name + " failed: " + response->error_message());
                 }
                 
-                // Parse gradients from response
-                std::vector<float> gradients;
-                const std::string& gradients_data = response.gradients();
-                size_t num_gradients = gradients_data.size() / sizeof(float);
-                gradients.resize(num_gradients);
-                std::memcpy(gradients.data(), gradients_data.data(), gradients_data.size());
-                
-                result = {gradients, response.loss()};
+                // Hand the response buffer to numpy instead of copying the gradients out of it
+                float loss = response->loss();
+                std::string* gradients_data = response->mutable_gradients();
+                result = {wrap_message_floats(std::move(response), gradients_data), loss};
             }
 
             // Print results
-            std::cout << "✓ Gradient computation successful!" << std::endl;
-            std::cout << "  Loss: " << result.second << std::endl;
-            std::cout << "  Gradients size: " << result.first.size() << " elements" << std::endl;
+            LEAF_LOG_INFO("✓ Gradient computation successful!");
+            LEAF_LOG_INFO("Loss: " << result.second);
+            LEAF_LOG_INFO("Gradients size: " << result.first.size() << " elements");
             
             // Print first few gradients as a sample
-            std::cout << "  Sample gradients: ";
-            for (size_t i = 0; i < std::min(size_t(5), result.first.size()); ++i) {
-                std::cout << result.first[i];
-                if (i < std::min(size_t(4), result.first.size() - 1)) {
-                    std::cout << ", ";
-                }
-            }
-            if (result.first.size() > 5) {
-                std::cout << ", ...";
-            }
-            std::cout << std::endl;
+            size_t num_gradients = static_cast<size_t>(result.first.size());
+            const float* gradients_data = result.first.data();
+            LEAF_LOG_INFO("Sample gradients: " << sample_values(gradients_data, num_gradients));
             
             // Store results
             server_result["success"] = true;
             server_result["loss"] = result.second;
-            server_result["gradients_size"] = result.first.size();
+            server_result["gradients_size"] = num_gradients;
             
-            // Convert gradients to Python list
-            py::list gradients_list;
-            for (const auto& grad : result.first) {
-                gradients_list.append(grad);
-            }
-            server_result["gradients"] = gradients_list;
+            // Gradients are returned as a numpy array that owns the response buffer (no per-element copy)
+            server_result["gradients"] = result.first;
             
         } catch (const std::exception& e) {
-            std::cout << "✗ Error testing server " << server_name << ": " << e.what() << std::endl;
+            LEAF_LOG_ERROR("✗ Error testing server " << server_name << ": " << e.what());
             server_result["success"] = false;
             server_result["error"] = e.what();
         }
@@ -963,12 +1236,1042 @@ py::dict LeafTrainer::test_with_hardcoded_values() {
         server_results.append(server_result);
     }
     
-    std::cout << "\n" << std::string(60, '=') << std::endl;
-    std::cout << "Gradient testing with hardcoded values completed!" << std::endl;
-    std::cout << std::string(60, '=') << std::endl;
+    LEAF_LOG_INFO(std::string(60, '='));
+    LEAF_LOG_INFO("Gradient testing with hardcoded values completed!");
+    LEAF_LOG_INFO(std::string(60, '='));
     
     // Return results
     results["server_results"] = server_results;
     results["total_servers"] = server_names.size();
     return results;
-} 
\ No newline at end of file
+} 
+
+void LeafTrainer::break_checkpoint_sharing() {
+    for (auto& share : checkpoint_shares) {
+        if (!share.snapshot.expired() && share.parameter.attr("data_ptr")().cast<uintptr_t>() == share.data_ptr) {
+            // The checkpoint keeps the old storage; the optimizer updates a private copy
+            share.parameter.attr("data") = share.parameter.attr("data").attr("clone")();
+        }
+    }
+    checkpoint_shares.clear();
+}
+
+py::dict LeafTrainer::checkpoint(const std::string& path, bool include_servers) {
+    py::object optimizer_module = py::module_::import("torch.optim.optimizer");
+    // Without step pre-hooks (torch < 2.0) in-place updates cannot be intercepted, so copy up front
+    bool copy_on_write = py::hasattr(optimizer_module, "register_optimizer_step_pre_hook");
+    if (copy_on_write && !step_hook_handle) {
+        step_hook_handle = optimizer_module.attr("register_optimizer_step_pre_hook")(
+            py::cpp_function([this](py::args) { break_checkpoint_sharing(); }));
+    }
+    
+    std::vector<std::shared_ptr<Model>> models;
+    {
+        std::lock_guard<std::mutex> lock(models_mutex);
+        models = local_models;
+    }
+    
+    CheckpointJob job;
+    job.path = path;
+    py::list owners;
+    std::set<uintptr_t> referenced;
+    for (size_t i = 0; i < models.size(); ++i) {
+        CheckpointTensor tensor;
+        tensor.model_id = "model_" + std::to_string(i);
+        tensor.architecture = models[i]->serialize_architecture();
+        tensor.chunks = models[i]->capture_state(owners, !copy_on_write);
+        for (const auto& chunk : tensor.chunks) {
+            tensor.count += chunk.second;
+            referenced.insert(reinterpret_cast<uintptr_t>(chunk.first));
+        }
+        job.tensors.push_back(std::move(tensor));
+    }
+    auto snapshot = share_py_object(owners);
+    job.keepalive.push_back(snapshot);
+    
+    if (copy_on_write) {
+        // Expired shares belong to checkpoints that are already written
+        checkpoint_shares.erase(std::remove_if(checkpoint_shares.begin(), checkpoint_shares.end(),
+                                               [](const CheckpointShare& share) { return share.snapshot.expired(); }),
+                                checkpoint_shares.end());
+        for (const auto& model : models) {
+            for (auto parameter : model->get_pytorch_model().attr("parameters")()) {
+                uintptr_t data_ptr = parameter.attr("data_ptr")().cast<uintptr_t>();
+                if (referenced.count(data_ptr) > 0) {
+                    checkpoint_shares.push_back({snapshot, py::reinterpret_borrow<py::object>(parameter), data_ptr});
+                }
+            }
+        }
+    }
+    checkpoint_writer.submit(std::move(job));
+    LEAF_LOG_INFO("Checkpoint of " << models.size() << " models queued for " << path);
+    
+    py::dict result;
+    result["path"] = path;
+    result["models"] = models.size();
+    py::dict server_results;
+    if (include_servers) {
+        for (const auto& server_name : config.get_servers()) {
+            py::dict server_info = config.get_server_info(server_name);
+            if (server_info["is_local"].cast<bool>() || !server_info["connected"].cast<bool>()) {
+                continue;
+            }
+            std::shared_ptr<grpc::Channel> channel;
+            {
+                std::lock_guard<std::mutex> lock(channel_mutex);
+                if (server_channels.find(server_name) == server_channels.end()) {
+                    server_channels[server_name] = create_channel(server_name);
+                }
+                channel = server_channels[server_name];
+            }
+            auto stub = leaftest::ServerCommunication::NewStub(channel);
+            leaftest::SaveCheckpointRequest request;
+            grpc::ClientContext context;
+            leaftest::SaveCheckpointResponse response;
+            grpc::Status status;
+            {
+                // The server only snapshots before replying, but there is no need to hold the GIL meanwhile
+                py::gil_scoped_release release;
+                status = stub->SaveCheckpoint(&context, request, &response);
+            }
+            if (!status.ok()) {
+                server_results[py::str(server_name)] = "RPC failed: " + status.error_message();
+            } else if (!response.success()) {
+                server_results[py::str(server_name)] = response.error_message();
+            } else {
+                server_results[py::str(server_name)] = "queued " + std::to_string(response.model_count()) +
+                                                       " models for " + response.path();
+            }
+        }
+    }
+    result["servers"] = server_results;
+    return result;
+}
+
+void LeafTrainer::wait_for_checkpoints() {
+    std::string error;
+    bool ok;
+    {
+        py::gil_scoped_release release;
+        ok = checkpoint_writer.flush(&error);
+    }
+    if (!ok) {
+        throw std::runtime_error("Checkpoint failed: " + error);
+    }
+}
+
+void LeafTrainer::start_heartbeats(uint32_t interval_ms) {
+    std::vector<std::string> remote_servers;
+    for (const auto& server_name : config.get_servers()) {
+        py::dict server_info = config.get_server_info(server_name);
+        if (!server_info["is_local"].cast<bool>() && server_info["connected"].cast<bool>()) {
+            remote_servers.push_back(server_name);
+        }
+    }
+    // Heartbeats get channels of their own so they are never queued behind large transfers
+    py::gil_scoped_release release;
+    heartbeat_monitor.start(remote_servers,
+                            [this](const std::string& server_name) { return create_channel(server_name); },
+                            std::chrono::milliseconds(std::max<uint32_t>(interval_ms, 50)));
+    LEAF_LOG_INFO("Monitoring heartbeats of " << remote_servers.size() << " servers every "
+                  << std::max<uint32_t>(interval_ms, 50) << "ms");
+}
+
+void LeafTrainer::stop_heartbeats() {
+    py::gil_scoped_release release;
+    heartbeat_monitor.stop();
+}
+
+// Metrics as {"counters": {name: value}, "histograms": {name: {"count", "mean", "p50", ...}}}
+static py::dict metrics_to_dict(const leaftest::MetricsResponse& response) {
+    py::dict counters;
+    for (const auto& counter : response.counters()) {
+        counters[py::str(counter.name())] = counter.value();
+    }
+    py::dict histograms;
+    for (const auto& histogram : response.histograms()) {
+        py::dict summary;
+        summary["count"] = histogram.count();
+        summary["sum"] = histogram.sum();
+        summary["mean"] = histogram.mean();
+        summary["max"] = histogram.max();
+        summary["p50"] = histogram.p50();
+        summary["p90"] = histogram.p90();
+        summary["p99"] = histogram.p99();
+        summary["p999"] = histogram.p999();
+        histograms[py::str(histogram.name())] = summary;
+    }
+    py::dict stats;
+    stats["counters"] = counters;
+    stats["histograms"] = histograms;
+    stats["uptime_ms"] = response.uptime_ms();
+    return stats;
+}
+
+py::dict LeafTrainer::get_stats(bool include_servers) {
+    leaftest::MetricsResponse trainer_metrics;
+    metrics_to_proto(metrics().snapshot(), &trainer_metrics);
+    py::dict stats;
+    stats["trainer"] = metrics_to_dict(trainer_metrics);
+    
+    py::dict server_stats;
+    if (include_servers) {
+        for (const auto& server_name : config.get_servers()) {
+            py::dict server_info = config.get_server_info(server_name);
+            if (server_info["is_local"].cast<bool>() || !server_info["connected"].cast<bool>()) {
+                continue;
+            }
+            std::shared_ptr<grpc::Channel> channel;
+            {
+                std::lock_guard<std::mutex> lock(channel_mutex);
+                if (server_channels.find(server_name) == server_channels.end()) {
+                    server_channels[server_name] = create_channel(server_name);
+                }
+                channel = server_channels[server_name];
+            }
+            auto stub = leaftest::ServerCommunication::NewStub(channel);
+            leaftest::MetricsRequest request;
+            leaftest::MetricsResponse response;
+            grpc::ClientContext context;
+            context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(10));
+            grpc::Status status;
+            {
+                py::gil_scoped_release release;
+                status = stub->GetMetrics(&context, request, &response);
+            }
+            if (!status.ok()) {
+                server_stats[py::str(server_name)] = "RPC failed: " + status.error_message();
+            } else if (!response.success()) {
+                server_stats[py::str(server_name)] = response.error_message();
+            } else {
+                server_stats[py::str(server_name)] = metrics_to_dict(response);
+            }
+        }
+    }
+    stats["servers"] = server_stats;
+    return stats;
+}
+
+void LeafTrainer::start_trace() {
+    tracer().start();
+    LEAF_LOG_INFO("Tracing started");
+}
+
+size_t LeafTrainer::stop_trace(const std::string& path) {
+    size_t count = tracer().stop(path);
+    LEAF_LOG_INFO("Wrote " << count << " trace events to " << path);
+    return count;
+}
+
+void LeafTrainer::set_trace_step(int64_t step) {
+    tracer().set_step(step);
+}
+
+TraceScope LeafTrainer::trace_span(const std::string& name, const std::string& category) {
+    return TraceScope(name, category);
+}
+
+py::dict LeafTrainer::get_server_load() const {
+    py::dict load;
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& [server_name, heartbeat] : heartbeat_monitor.get_status()) {
+        py::dict server;
+        server["alive"] = heartbeat.alive;
+        server["error"] = heartbeat.error;
+        if (heartbeat.received) {
+            const auto& latest = heartbeat.latest;
+            server["age_ms"] = std::chrono::duration_cast<std::chrono::milliseconds>(now - heartbeat.last_seen).count();
+            server["sequence"] = latest.sequence();
+            server["queue_depth"] = latest.queue_depth();
+            server["in_flight_requests"] = latest.in_flight_requests();
+            server["completed_requests"] = latest.completed_requests();
+            server["recent_step_ms"] = std::vector<float>(latest.recent_step_ms().begin(), latest.recent_step_ms().end());
+            server["cpu_percent"] = latest.cpu_percent();
+            server["rss_bytes"] = latest.rss_bytes();
+        }
+        load[py::str(server_name)] = server;
+    }
+    return load;
+}
+
+std::shared_ptr<grpc::Channel> LeafTrainer::get_channel(const std::string& server_name) {
+    std::lock_guard<std::mutex> lock(channel_mutex);
+    if (server_channels.find(server_name) == server_channels.end()) {
+        server_channels[server_name] = create_channel(server_name);
+    }
+    return server_channels[server_name];
+}
+
+LeafTrainer::ParameterShardLayout LeafTrainer::get_parameter_layout(const std::string& model_id) {
+    std::lock_guard<std::mutex> lock(layout_mutex);
+    auto it = parameter_layouts.find(model_id);
+    if (it == parameter_layouts.end()) {
+        throw std::runtime_error("No parameter shards for model " + model_id +
+                                 "; call create_parameter_shards or pull_parameters with its servers first");
+    }
+    return it->second;
+}
+
+// Run call(i) for every shard on its own thread so the shards' RPCs overlap. Throws the first
+// failure once all of them have finished.
+static void for_each_shard(size_t count, const std::function<void(size_t)>& call) {
+    std::vector<std::string> errors(count);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; ++i) {
+        threads.emplace_back([&, i]() {
+            try {
+                call(i);
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (!error.empty()) {
+            throw std::runtime_error(error);
+        }
+    }
+}
+
+void LeafTrainer::create_parameter_shards(const std::string& model_id,
+                                          py::array_t<float, py::array::c_style | py::array::forcecast> parameters,
+                                          const std::vector<std::string>& servers,
+                                          float learning_rate,
+                                          float momentum,
+                                          float weight_decay,
+                                          uint32_t workers,
+                                          const std::string& optimizer,
+                                          float beta1,
+                                          float beta2,
+                                          float epsilon) {
+    static RpcMetrics rpc("InitParameterShard");
+    parse_optimizer_kind(optimizer);  // Reject a typo here rather than on every server
+    size_t total = static_cast<size_t>(parameters.size());
+    if (servers.empty() || servers.size() > total) {
+        throw std::invalid_argument("Need between 1 and " + std::to_string(total) + " parameter servers, got " +
+                                    std::to_string(servers.size()));
+    }
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (const auto& server_name : servers) {
+        py::dict server_info = config.get_server_info(server_name);
+        if (!server_info.contains("connected") || !server_info["connected"].cast<bool>() ||
+            server_info["is_local"].cast<bool>()) {
+            throw std::runtime_error("Parameter server " + server_name + " is not a connected remote server");
+        }
+        channels.push_back(get_channel(server_name));
+    }
+    
+    ParameterShardLayout layout;
+    layout.servers = servers;
+    layout.ranges = shard_ranges(total, servers.size());
+    layout.total_count = total;
+    const float* data = parameters.data();
+    {
+        py::gil_scoped_release release;
+        for_each_shard(servers.size(), [&](size_t i) {
+            const std::string& server_name = servers[i];
+            size_t offset = layout.ranges[i].first;
+            size_t count = layout.ranges[i].second;
+            leaftest::InitShardRequest request;
+            request.set_model_id(model_id);
+            request.set_offset(offset);
+            request.set_total_count(total);
+            request.set_parameters(data + offset, count * sizeof(float));
+            auto* shard_optimizer = request.mutable_optimizer();
+            shard_optimizer->set_kind(optimizer);
+            shard_optimizer->set_learning_rate(learning_rate);
+            shard_optimizer->set_momentum(momentum);
+            shard_optimizer->set_weight_decay(weight_decay);
+            shard_optimizer->set_beta1(beta1);
+            shard_optimizer->set_beta2(beta2);
+            shard_optimizer->set_epsilon(epsilon);
+            request.set_workers(workers);
+            
+            grpc::ClientContext context;
+            context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(60));
+            leaftest::InitShardResponse response;
+            grpc::Status status;
+            {
+                HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+                ScopedTimer timer(rpc.latency_us);
+                status = leaftest::ServerCommunication::NewStub(channels[i])->InitParameterShard(&context, request, &response);
+            }
+            rpc.bytes_out.add(request.ByteSizeLong());
+            rpc.bytes_in.add(response.ByteSizeLong());
+            if (!status.ok() || !response.success()) {
+                rpc.failures.add();
+            }
+            if (!status.ok()) {
+                throw std::runtime_error(server_name + ": RPC failed: " + status.error_message());
+            }
+            if (!response.success()) {
+                throw std::runtime_error(server_name + ": " + response.error_message());
+            }
+        });
+    }
+    LEAF_LOG_INFO("Sharded " << total << " parameters of " << model_id << " over " << servers.size()
+                  << " parameter servers running " << optimizer);
+    std::lock_guard<std::mutex> lock(layout_mutex);
+    parameter_layouts[model_id] = std::move(layout);
+}
+
+uint64_t LeafTrainer::push_gradients(const std::string& model_id,
+                                     py::array_t<float, py::array::c_style | py::array::forcecast> gradients) {
+    static RpcMetrics rpc("PushGradients");
+    ParameterShardLayout layout = get_parameter_layout(model_id);
+    if (static_cast<size_t>(gradients.size()) != layout.total_count) {
+        throw std::invalid_argument("Expected " + std::to_string(layout.total_count) + " gradients for " + model_id +
+                                    ", got " + std::to_string(gradients.size()));
+    }
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (const auto& server_name : layout.servers) {
+        channels.push_back(get_channel(server_name));
+    }
+    
+    const float* data = gradients.data();
+    std::vector<uint64_t> versions(layout.servers.size());
+    {
+        py::gil_scoped_release release;
+        for_each_shard(layout.servers.size(), [&](size_t i) {
+            const std::string& server_name = layout.servers[i];
+            if (!heartbeat_monitor.is_alive(server_name)) {
+                throw std::runtime_error(server_name + ": server stopped sending heartbeats");
+            }
+            size_t offset = layout.ranges[i].first;
+            size_t count = layout.ranges[i].second;
+            leaftest::PushGradientsRequest request;
+            request.set_model_id(model_id);
+            request.set_offset(offset);
+            request.set_gradients(data + offset, count * sizeof(float));
+            
+            grpc::ClientContext context;
+            context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(60));
+            leaftest::PushGradientsResponse response;
+            grpc::Status status;
+            TraceSpan span("PushGradients", "rpc", server_name);
+            {
+                HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+                ScopedTimer timer(rpc.latency_us);
+                status = leaftest::ServerCommunication::NewStub(channels[i])->PushGradients(&context, request, &response);
+            }
+            span.finish();
+            rpc.bytes_out.add(request.ByteSizeLong());
+            rpc.bytes_in.add(response.ByteSizeLong());
+            if (!status.ok() || !response.success()) {
+                rpc.failures.add();
+            }
+            if (!status.ok()) {
+                throw std::runtime_error(server_name + ": RPC failed: " + status.error_message());
+            }
+            if (!response.success()) {
+                throw std::runtime_error(server_name + ": " + response.error_message());
+            }
+            versions[i] = response.version();
+        });
+    }
+    return *std::min_element(versions.begin(), versions.end());
+}
+
+py::array_t<float> LeafTrainer::pull_parameters(const std::string& model_id,
+                                                uint64_t min_version,
+                                                uint32_t wait_ms,
+                                                const std::vector<std::string>& servers) {
+    static RpcMetrics rpc("PullParameters");
+    // Attaching learns the offsets from the shards themselves
+    std::vector<std::string> shard_servers = servers.empty() ? get_parameter_layout(model_id).servers : servers;
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (const auto& server_name : shard_servers) {
+        channels.push_back(get_channel(server_name));
+    }
+    
+    std::vector<leaftest::PullParametersResponse> responses(shard_servers.size());
+    {
+        py::gil_scoped_release release;
+        for_each_shard(shard_servers.size(), [&](size_t i) {
+            const std::string& server_name = shard_servers[i];
+            if (!heartbeat_monitor.is_alive(server_name)) {
+                throw std::runtime_error(server_name + ": server stopped sending heartbeats");
+            }
+            leaftest::PullParametersRequest request;
+            request.set_model_id(model_id);
+            request.set_min_version(min_version);
+            request.set_wait_ms(wait_ms);
+            
+            grpc::ClientContext context;
+            context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(wait_ms) +
+                                 std::chrono::seconds(60));
+            grpc::Status status;
+            TraceSpan span("PullParameters", "rpc", server_name);
+            {
+                HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+                ScopedTimer timer(rpc.latency_us);
+                status = leaftest::ServerCommunication::NewStub(channels[i])->PullParameters(&context, request, &responses[i]);
+            }
+            span.finish();
+            rpc.bytes_out.add(request.ByteSizeLong());
+            rpc.bytes_in.add(responses[i].ByteSizeLong());
+            if (!status.ok() || !responses[i].success()) {
+                rpc.failures.add();
+            }
+            if (!status.ok()) {
+                throw std::runtime_error(server_name + ": RPC failed: " + status.error_message());
+            }
+            if (!responses[i].success()) {
+                throw std::runtime_error(server_name + ": " + responses[i].error_message());
+            }
+        });
+    }
+    
+    // The shards must tile the parameter vector in server order
+    ParameterShardLayout layout;
+    layout.servers = shard_servers;
+    layout.total_count = responses[0].total_count();
+    size_t expected_offset = 0;
+    for (size_t i = 0; i < responses.size(); ++i) {
+        size_t count = responses[i].parameters().size() / sizeof(float);
+        if (responses[i].total_count() != layout.total_count || responses[i].offset() != expected_offset) {
+            throw std::runtime_error("Shard of " + model_id + " on " + shard_servers[i] + " at offset " +
+                                     std::to_string(responses[i].offset()) + " does not follow the previous shards");
+        }
+        layout.ranges.emplace_back(expected_offset, count);
+        expected_offset += count;
+    }
+    if (expected_offset != layout.total_count) {
+        throw std::runtime_error("Shards of " + model_id + " hold " + std::to_string(expected_offset) + " of " +
+                                 std::to_string(layout.total_count) + " parameters");
+    }
+    
+    std::vector<float> values(layout.total_count);
+    for (size_t i = 0; i < responses.size(); ++i) {
+        const std::string& bytes = responses[i].parameters();
+        std::memcpy(values.data() + layout.ranges[i].first, bytes.data(), bytes.size());
+    }
+    if (!servers.empty()) {
+        std::lock_guard<std::mutex> lock(layout_mutex);
+        parameter_layouts[model_id] = std::move(layout);
+    }
+    py::ssize_t count = static_cast<py::ssize_t>(values.size());
+    return wrap_vector_floats(std::move(values), {count});
+}
+
+// Rows of a data shard sent per StoreDataShard request, well below the channel's 100MB limit
+constexpr size_t data_shard_chunk_bytes = 16 * 1024 * 1024;
+
+// torch.save() obj into bytes, e.g. a loss module for the servers to load
+static std::string torch_save_bytes(py::object obj) {
+    py::object buffer = py::module_::import("io").attr("BytesIO")();
+    py::module_::import("torch").attr("save")(obj, buffer);
+    return buffer.attr("getvalue")().cast<std::string>();
+}
+
+std::vector<std::string> LeafTrainer::training_servers(const std::vector<std::string>& servers,
+                                                       std::vector<std::shared_ptr<grpc::Channel>>* channels) {
+    std::vector<std::string> workers = servers;
+    if (workers.empty()) {
+        for (const auto& server_name : config.get_servers()) {
+            py::dict server_info = config.get_server_info(server_name);
+            if (server_info["connected"].cast<bool>() && !server_info["is_local"].cast<bool>()) {
+                workers.push_back(server_name);
+            }
+        }
+    }
+    for (const auto& server_name : workers) {
+        py::dict server_info = config.get_server_info(server_name);
+        if (!server_info.contains("connected") || !server_info["connected"].cast<bool>() ||
+            server_info["is_local"].cast<bool>()) {
+            throw std::runtime_error("Training server " + server_name + " is not a connected remote server");
+        }
+        channels->push_back(get_channel(server_name));
+    }
+    if (workers.empty()) {
+        throw std::runtime_error("Server-side training needs at least one connected remote server");
+    }
+    return workers;
+}
+
+size_t LeafTrainer::upload_data_shards(const std::string& shard_id,
+                                       py::object inputs,
+                                       py::object targets,
+                                       const std::vector<std::string>& workers,
+                                       const std::vector<std::shared_ptr<grpc::Channel>>& channels) {
+    static RpcMetrics store_rpc("StoreDataShard");
+    
+    // Contiguous CPU copies of the data: float32 inputs, and int64 class indices or float32 targets
+    py::object torch = py::module_::import("torch");
+    py::object input_tensor = torch.attr("as_tensor")(inputs).attr("detach")().attr("cpu")();
+    py::object target_tensor = torch.attr("as_tensor")(targets).attr("detach")().attr("cpu")();
+    bool integer_targets = !target_tensor.attr("is_floating_point")().cast<bool>();
+    input_tensor = input_tensor.attr("float")().attr("contiguous")();
+    target_tensor = (integer_targets ? target_tensor.attr("long")() : target_tensor.attr("float")()).attr("contiguous")();
+    std::vector<int64_t> input_shape = input_tensor.attr("shape").cast<std::vector<int64_t>>();
+    std::vector<int64_t> target_shape = target_tensor.attr("shape").cast<std::vector<int64_t>>();
+    if (input_shape.empty() || target_shape.empty() || input_shape[0] != target_shape[0]) {
+        throw std::invalid_argument("inputs and targets need the same number of rows");
+    }
+    size_t rows = static_cast<size_t>(input_shape[0]);
+    if (rows < workers.size()) {
+        throw std::invalid_argument("Need at least one row per server, got " + std::to_string(rows) + " rows for " +
+                                    std::to_string(workers.size()) + " servers");
+    }
+    size_t input_row_bytes = input_tensor.attr("numel")().cast<size_t>() * sizeof(float) / rows;
+    size_t target_row_bytes = target_tensor.attr("numel")().cast<size_t>() *
+                              (integer_targets ? sizeof(int64_t) : sizeof(float)) / rows;
+    const char* input_data = reinterpret_cast<const char*>(input_tensor.attr("data_ptr")().cast<uintptr_t>());
+    const char* target_data = reinterpret_cast<const char*>(target_tensor.attr("data_ptr")().cast<uintptr_t>());
+    
+    auto ranges = shard_ranges(rows, workers.size());
+    LEAF_LOG_INFO("Storing " << rows << " training rows as " << shard_id << " on " << workers.size() << " servers");
+    {
+        // Each server keeps its rows for every step, so the data crosses the network only once
+        py::gil_scoped_release release;
+        for_each_shard(workers.size(), [&](size_t i) {
+            auto stub = leaftest::ServerCommunication::NewStub(channels[i]);
+            RowChunks chunks = plan_row_chunks(ranges[i].second, (input_row_bytes + target_row_bytes) / sizeof(float),
+                                               data_shard_chunk_bytes);
+            for (size_t chunk = 0; chunk < chunks.num_chunks; ++chunk) {
+                size_t first = ranges[i].first + chunk * chunks.rows_per_chunk;
+                size_t count = std::min(chunks.rows_per_chunk, ranges[i].first + ranges[i].second - first);
+                leaftest::StoreDataShardRequest request;
+                request.set_shard_id(shard_id);
+                request.set_append(chunk > 0);
+                request.set_inputs(input_data + first * input_row_bytes, count * input_row_bytes);
+                request.add_input_shape(static_cast<int64_t>(count));
+                for (size_t dim = 1; dim < input_shape.size(); ++dim) {
+                    request.add_input_shape(input_shape[dim]);
+                }
+                request.set_targets(target_data + first * target_row_bytes, count * target_row_bytes);
+                request.add_target_shape(static_cast<int64_t>(count));
+                for (size_t dim = 1; dim < target_shape.size(); ++dim) {
+                    request.add_target_shape(target_shape[dim]);
+                }
+                request.set_integer_targets(integer_targets);
+                
+                grpc::ClientContext context;
+                context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(120));
+                leaftest::StoreDataShardResponse response;
+                grpc::Status status;
+                {
+                    HeartbeatMonitor::CallGuard guard(heartbeat_monitor, workers[i], &context);
+                    ScopedTimer timer(store_rpc.latency_us);
+                    status = stub->StoreDataShard(&context, request, &response);
+                }
+                store_rpc.bytes_out.add(request.ByteSizeLong());
+                store_rpc.bytes_in.add(response.ByteSizeLong());
+                if (!status.ok() || !response.success()) {
+                    store_rpc.failures.add();
+                }
+                if (!status.ok()) {
+                    throw std::runtime_error(workers[i] + ": RPC failed: " + status.error_message());
+                }
+                if (!response.success()) {
+                    throw std::runtime_error(workers[i] + ": " + response.error_message());
+                }
+            }
+        });
+    }
+    return rows;
+}
+
+py::dict LeafTrainer::train_local_sgd(py::object model,
+                                      py::object inputs,
+                                      py::object targets,
+                                      py::object criterion,
+                                      int rounds,
+                                      uint32_t local_steps,
+                                      uint32_t batch_size,
+                                      const std::vector<std::string>& servers,
+                                      const std::string& optimizer,
+                                      float learning_rate,
+                                      float momentum,
+                                      float weight_decay,
+                                      uint64_t seed) {
+    static RpcMetrics train_rpc("LocalTrain");
+    parse_optimizer_kind(optimizer);  // Reject a typo before uploading anything
+    auto distributed = model.cast<std::shared_ptr<DistributedModel>>();
+    std::string model_id = "model_" + std::to_string(distributed->get_index());
+    std::string shard_id = "local_sgd_" + model_id;
+    
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    std::vector<std::string> workers = training_servers(servers, &channels);
+    std::string criterion_definition = torch_save_bytes(criterion);
+    LEAF_LOG_INFO("Local SGD of " << model_id << " over " << workers.size() << " servers, "
+                  << rounds << " rounds of " << local_steps << " local steps");
+    size_t rows = upload_data_shards(shard_id, inputs, targets, workers, channels);
+    
+    py::list history;
+    std::vector<float> state = distributed->serialize_state();
+    for (int round = 0; round < rounds; ++round) {
+        auto round_start = std::chrono::steady_clock::now();
+        std::vector<leaftest::LocalTrainResponse> responses(workers.size());
+        std::atomic<size_t> round_bytes(0);
+        {
+            py::gil_scoped_release release;
+            for_each_shard(workers.size(), [&](size_t i) {
+                const std::string& server_name = workers[i];
+                if (!heartbeat_monitor.is_alive(server_name)) {
+                    throw std::runtime_error(server_name + ": server stopped sending heartbeats");
+                }
+                leaftest::LocalTrainRequest request;
+                request.set_model_id(model_id);
+                request.set_shard_id(shard_id);
+                request.set_model_state(state.data(), state.size() * sizeof(float));
+                request.set_criterion(criterion_definition);
+                auto* round_optimizer = request.mutable_optimizer();
+                round_optimizer->set_kind(optimizer);
+                round_optimizer->set_learning_rate(learning_rate);
+                round_optimizer->set_momentum(momentum);
+                round_optimizer->set_weight_decay(weight_decay);
+                round_optimizer->set_beta1(0.9f);
+                round_optimizer->set_beta2(0.999f);
+                round_optimizer->set_epsilon(1e-8f);
+                request.set_reset_optimizer(round == 0);
+                request.set_steps(local_steps);
+                request.set_batch_size(batch_size);
+                request.set_seed(seed * 1000003 + static_cast<uint64_t>(round) * workers.size() + i);
+                request.set_trace(tracer().is_enabled());
+                
+                // A round runs as long as its local steps take; a server that dies is caught by
+                // its heartbeats rather than a deadline
+                grpc::ClientContext context;
+                grpc::Status status;
+                int64_t rpc_start_us = trace_now_us();
+                {
+                    HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+                    ScopedTimer timer(train_rpc.latency_us);
+                    status = leaftest::ServerCommunication::NewStub(channels[i])->LocalTrain(&context, request, &responses[i]);
+                }
+                tracer().record_rpc("LocalTrain", server_name, rpc_start_us, trace_now_us(), responses[i].trace_events());
+                train_rpc.bytes_out.add(request.ByteSizeLong());
+                train_rpc.bytes_in.add(responses[i].ByteSizeLong());
+                round_bytes += request.ByteSizeLong() + responses[i].ByteSizeLong();
+                if (!status.ok() || !responses[i].success()) {
+                    train_rpc.failures.add();
+                }
+                if (!status.ok()) {
+                    throw std::runtime_error(server_name + ": RPC failed: " + status.error_message());
+                }
+                if (!responses[i].success()) {
+                    throw std::runtime_error(server_name + ": " + responses[i].error_message());
+                }
+                if (responses[i].model_state().size() != state.size() * sizeof(float)) {
+                    throw std::runtime_error(server_name + " returned " +
+                                             std::to_string(responses[i].model_state().size() / sizeof(float)) +
+                                             " weights, expected " + std::to_string(state.size()));
+                }
+            });
+            
+            // Average the servers' models, each weighted by the rows it trained on
+            double total_samples = 0.0;
+            for (const auto& response : responses) {
+                total_samples += static_cast<double>(response.samples());
+            }
+            std::fill(state.begin(), state.end(), 0.0f);
+            for (const auto& response : responses) {
+                float weight = total_samples > 0.0 ? static_cast<float>(response.samples() / total_samples)
+                                                   : 1.0f / static_cast<float>(responses.size());
+                const float* trained = reinterpret_cast<const float*>(response.model_state().data());
+                for (size_t j = 0; j < state.size(); ++j) {
+                    state[j] += weight * trained[j];
+                }
+            }
+        }
+        
+        double loss = 0.0;
+        uint64_t samples = 0;
+        for (const auto& response : responses) {
+            loss += response.mean_loss() * static_cast<double>(response.samples());
+            samples += response.samples();
+        }
+        loss = samples > 0 ? loss / static_cast<double>(samples) : 0.0;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - round_start).count();
+        LEAF_LOG_INFO("Local SGD round " << (round + 1) << "/" << rounds << ": loss " << loss << ", "
+                      << samples << " samples in " << seconds << "s");
+        py::dict entry;
+        entry["round"] = round;
+        entry["loss"] = loss;
+        entry["samples"] = samples;
+        entry["seconds"] = seconds;
+        entry["bytes"] = round_bytes.load();
+        history.append(entry);
+    }
+    
+    // A pending checkpoint may still reference the parameters; keep its copy intact
+    break_checkpoint_sharing();
+    distributed->deserialize_state(state);
+    
+    py::dict result;
+    result["servers"] = workers;
+    result["rows"] = rows;
+    result["local_steps"] = local_steps;
+    result["rounds"] = history;
+    return result;
+}
+
+py::dict LeafTrainer::train_async_sgd(py::object model,
+                                      py::object inputs,
+                                      py::object targets,
+                                      py::object criterion,
+                                      uint64_t updates,
+                                      uint32_t batch_size,
+                                      uint32_t max_staleness,
+                                      const std::string& stale_policy,
+                                      const std::vector<std::string>& servers,
+                                      const std::string& optimizer,
+                                      float learning_rate,
+                                      float momentum,
+                                      float weight_decay,
+                                      uint64_t seed) {
+    static RpcMetrics gradients_rpc("ComputeGradients");
+    static RpcMetrics store_rpc("StoreModelWeights");
+    static Histogram& staleness_hist = metrics().histogram("async_sgd.staleness");
+    if (stale_policy != "drop" && stale_policy != "scale") {
+        throw std::invalid_argument("stale_policy must be \"drop\" or \"scale\", got \"" + stale_policy + "\"");
+    }
+    if (updates == 0) {
+        throw std::invalid_argument("updates must be at least 1");
+    }
+    bool scale_stale = stale_policy == "scale";
+    OptimizerOptions options;
+    options.kind = parse_optimizer_kind(optimizer);
+    options.learning_rate = learning_rate;
+    options.momentum = momentum;
+    options.weight_decay = weight_decay;
+    auto distributed = model.cast<std::shared_ptr<DistributedModel>>();
+    std::string model_id = "model_" + std::to_string(distributed->get_index());
+    std::string shard_id = "async_sgd_" + model_id;
+    
+    // Offsets of the trainable parameters in serialize_state's layout (state_dict order), matched
+    // by storage; servers send gradients in module.parameters() order. A tied weight appears once
+    // in parameters() but under every name in state_dict, so it is updated at its first offset
+    // and copied to the others.
+    struct ParameterSlot {
+        size_t gradient_offset;
+        size_t count;
+        std::vector<size_t> state_offsets;
+    };
+    std::vector<ParameterSlot> slots;
+    size_t gradient_count = 0;
+    std::vector<float> state = distributed->serialize_state();
+    {
+        py::object module = distributed->get_pytorch_model();
+        std::map<uintptr_t, std::vector<size_t>> state_offsets;
+        size_t offset = 0;
+        for (auto item : module.attr("state_dict")().attr("items")()) {
+            py::object tensor = item.attr("__getitem__")(1);
+            state_offsets[tensor.attr("data_ptr")().cast<uintptr_t>()].push_back(offset);
+            offset += tensor.attr("numel")().cast<size_t>();
+        }
+        for (auto parameter : module.attr("parameters")()) {
+            if (!parameter.attr("requires_grad").cast<bool>()) {
+                continue;
+            }
+            size_t count = parameter.attr("numel")().cast<size_t>();
+            auto it = state_offsets.find(parameter.attr("data_ptr")().cast<uintptr_t>());
+            if (it == state_offsets.end()) {
+                throw std::runtime_error("A trainable parameter of " + model_id + " is not in its state_dict");
+            }
+            slots.push_back({gradient_count, count, it->second});
+            gradient_count += count;
+        }
+    }
+    std::vector<FlatOptimizer> optimizers;
+    for (const auto& slot : slots) {
+        optimizers.emplace_back(options, slot.count);
+    }
+    
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    std::vector<std::string> workers = training_servers(servers, &channels);
+    std::string criterion_definition = torch_save_bytes(criterion);
+    LEAF_LOG_INFO("Async SGD of " << model_id << " over " << workers.size() << " servers, " << updates
+                  << " updates, staleness bound " << max_staleness << " (" << stale_policy << ")");
+    size_t rows = upload_data_shards(shard_id, inputs, targets, workers, channels);
+    
+    struct WorkerStats {
+        uint64_t pushed = 0;
+        uint64_t applied = 0;
+        uint64_t rejected = 0;
+        uint64_t scaled = 0;
+        uint64_t max_staleness = 0;
+        uint64_t staleness_sum = 0;
+    };
+    std::vector<WorkerStats> stats(workers.size());
+    std::vector<std::pair<uint64_t, double>> losses;  // (version after the update, loss) per applied gradient
+    std::mutex master_mutex;                            // Guards state, optimizers, version, stats, losses
+    uint64_t version = 0;
+    std::atomic<uint64_t> next_seed(0);
+    std::atomic<bool> stop(false);
+    auto start = std::chrono::steady_clock::now();
+    
+    // Weights at a version for one server; ComputeGradients then reports that version
+    auto store_weights = [&](size_t i, const std::vector<float>& weights, uint64_t weights_version) {
+        leaftest::StoreModelWeightsRequest request;
+        request.set_model_id(model_id);
+        request.set_model_state(weights.data(), weights.size() * sizeof(float));
+        request.set_version(weights_version);
+        grpc::ClientContext context;
+        leaftest::StoreModelWeightsResponse response;
+        grpc::Status status;
+        {
+            HeartbeatMonitor::CallGuard guard(heartbeat_monitor, workers[i], &context);
+            ScopedTimer timer(store_rpc.latency_us);
+            status = leaftest::ServerCommunication::NewStub(channels[i])->StoreModelWeights(&context, request, &response);
+        }
+        store_rpc.bytes_out.add(request.ByteSizeLong());
+        store_rpc.bytes_in.add(response.ByteSizeLong());
+        if (!status.ok() || !response.success()) {
+            store_rpc.failures.add();
+        }
+        if (!status.ok()) {
+            throw std::runtime_error(workers[i] + ": RPC failed: " + status.error_message());
+        }
+        if (!response.success()) {
+            throw std::runtime_error(workers[i] + ": " + response.error_message());
+        }
+    };
+    
+    {
+        py::gil_scoped_release release;
+        for_each_shard(workers.size(), [&](size_t i) { store_weights(i, state, 0); });
+        
+        // No barrier: each server's loop only waits for its own RPCs and a short critical section
+        for_each_shard(workers.size(), [&](size_t i) {
+            const std::string& server_name = workers[i];
+            try {
+                std::vector<float> weights;
+                while (!stop) {
+                    if (!heartbeat_monitor.is_alive(server_name)) {
+                        throw std::runtime_error(server_name + ": server stopped sending heartbeats");
+                    }
+                    leaftest::ComputeGradientsRequest request;
+                    request.set_model_id(model_id);
+                    request.set_shard_id(shard_id);
+                    request.set_criterion(criterion_definition);
+                    request.set_batch_size(batch_size);
+                    request.set_seed(seed * 1000003 + next_seed++);
+                    request.set_trace(tracer().is_enabled());
+                    
+                    grpc::ClientContext context;
+                    leaftest::ComputeGradientsResponse response;
+                    grpc::Status status;
+                    int64_t rpc_start_us = trace_now_us();
+                    {
+                        HeartbeatMonitor::CallGuard guard(heartbeat_monitor, server_name, &context);
+                        ScopedTimer timer(gradients_rpc.latency_us);
+                        status = leaftest::ServerCommunication::NewStub(channels[i])->ComputeGradients(&context, request, &response);
+                    }
+                    tracer().record_rpc("ComputeGradients", server_name, rpc_start_us, trace_now_us(), response.trace_events());
+                    gradients_rpc.bytes_out.add(request.ByteSizeLong());
+                    gradients_rpc.bytes_in.add(response.ByteSizeLong());
+                    if (!status.ok() || !response.success()) {
+                        gradients_rpc.failures.add();
+                    }
+                    if (!status.ok()) {
+                        throw std::runtime_error(server_name + ": RPC failed: " + status.error_message());
+                    }
+                    if (!response.success()) {
+                        throw std::runtime_error(server_name + ": " + response.error_message());
+                    }
+                    if (response.gradients().size() != gradient_count * sizeof(float)) {
+                        throw std::runtime_error(server_name + " returned " +
+                                                 std::to_string(response.gradients().size() / sizeof(float)) +
+                                                 " gradients, expected " + std::to_string(gradient_count));
+                    }
+                    
+                    uint64_t weights_version;
+                    {
+                        std::lock_guard<std::mutex> lock(master_mutex);
+                        if (stop) {
+                            break;
+                        }
+                        WorkerStats& worker = stats[i];
+                        uint64_t staleness = version >= response.version() ? version - response.version() : 0;
+                        staleness_hist.record(staleness);
+                        worker.pushed++;
+                        worker.max_staleness = std::max(worker.max_staleness, staleness);
+                        worker.staleness_sum += staleness;
+                        
+                        float grad_scale = 1.0f;
+                        bool apply = true;
+                        if (staleness > max_staleness) {
+                            if (scale_stale) {
+                                grad_scale = static_cast<float>(max_staleness + 1) / static_cast<float>(staleness + 1);
+                                worker.scaled++;
+                            } else {
+                                apply = false;
+                                worker.rejected++;
+                            }
+                        }
+                        if (apply) {
+                            const float* gradients = reinterpret_cast<const float*>(response.gradients().data());
+                            for (size_t p = 0; p < slots.size(); ++p) {
+                                const ParameterSlot& slot = slots[p];
+                                float* parameter = state.data() + slot.state_offsets[0];
+                                optimizers[p].step(parameter, gradients + slot.gradient_offset, slot.count, grad_scale);
+                                for (size_t copy = 1; copy < slot.state_offsets.size(); ++copy) {
+                                    std::memcpy(state.data() + slot.state_offsets[copy], parameter, slot.count * sizeof(float));
+                                }
+                            }
+                            version++;
+                            worker.applied++;
+                            losses.emplace_back(version, response.loss());
+                            if (version >= updates) {
+                                stop = true;
+                            }
+                        }
+                        weights = state;
+                        weights_version = version;
+                    }
+                    if (stop) {
+                        break;
+                    }
+                    store_weights(i, weights, weights_version);
+                }
+            } catch (...) {
+                stop = true;
+                throw;
+            }
+        });
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    // A pending checkpoint may still reference the parameters; keep its copy intact
+    break_checkpoint_sharing();
+    distributed->deserialize_state(state);
+    
+    py::list worker_stats;
+    uint64_t rejected = 0;
+    uint64_t scaled = 0;
+    for (size_t i = 0; i < workers.size(); ++i) {
+        py::dict entry;
+        entry["server"] = workers[i];
+        entry["pushed"] = stats[i].pushed;
+        entry["applied"] = stats[i].applied;
+        entry["rejected"] = stats[i].rejected;
+        entry["scaled"] = stats[i].scaled;
+        entry["max_staleness"] = stats[i].max_staleness;
+        entry["mean_staleness"] = stats[i].pushed > 0 ? static_cast<double>(stats[i].staleness_sum) / stats[i].pushed : 0.0;
+        worker_stats.append(entry);
+        rejected += stats[i].rejected;
+        scaled += stats[i].scaled;
+    }
+    py::list loss_history;
+    for (const auto& [update, loss] : losses) {
+        loss_history.append(py::make_tuple(update, loss));
+    }
+    LEAF_LOG_INFO("Async SGD applied " << version << " updates in " << seconds << "s, rejected " << rejected
+                  << " and scaled " << scaled << " stale gradients");
+    
+    py::dict result;
+    result["servers"] = workers;
+    result["rows"] = rows;
+    result["updates"] = version;
+    result["rejected"] = rejected;
+    result["scaled"] = scaled;
+    result["seconds"] = seconds;
+    result["workers"] = worker_stats;
+    result["losses"] = loss_history;
+    return result;
+}
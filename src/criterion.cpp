@@ -1,17 +1,44 @@
 #include "criterion.h"
-#include <iostream>
+#include "model.h"
+#include "logging.h"
 #include <cstring>
 
 namespace py = pybind11;
 
+// Bytes of a tensor or of a list/tuple of tensors (divided targets)
+static size_t stored_nbytes(const py::object& value) {
+    if (py::isinstance<py::list>(value) || py::isinstance<py::tuple>(value)) {
+        size_t nbytes = 0;
+        for (auto item : value) {
+            nbytes += tensor_nbytes(py::reinterpret_borrow<py::object>(item));
+        }
+        return nbytes;
+    }
+    return tensor_nbytes(value);
+}
+
 Criterion::Criterion(py::object criterion, LeafTrainer* trainer)
-    : pytorch_criterion(criterion), leaf_trainer(trainer), loss(0.0f) {}
+    : pytorch_criterion(criterion), leaf_trainer(trainer), loss(0.0f),
+      stored_bytes(0), max_stored_bytes(256 * 1024 * 1024) {}
+
+void Criterion::store_batch(py::object outputs, py::object targets, bool divided) {
+    size_t bytes = stored_nbytes(outputs) + stored_nbytes(targets);
+    stored_batches.push_back({outputs, targets, divided, bytes});
+    stored_bytes += bytes;
+    evict_stored_batches();
+}
+
+void Criterion::evict_stored_batches() {
+    while (stored_bytes > max_stored_bytes && stored_batches.size() > 1) {
+        stored_bytes -= stored_batches.front().bytes;
+        stored_batches.pop_front();
+    }
+}
 
 bool Criterion::forward(py::object outputs, py::object targets) {
     try {
         // Store outputs and targets for later use
-        stored_outputs.push_back(outputs);
-        stored_targets.push_back(targets);
+        store_batch(outputs, targets, false);
         
         // Call the original criterion's forward method
         py::object loss_tensor = pytorch_criterion.attr("__call__")(outputs, targets);
@@ -32,7 +59,7 @@ bool Criterion::forward(py::object outputs, py::object targets) {
         
         return true;
     } catch (const std::exception& e) {
-        std::cout << "Error in Criterion::forward: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error in Criterion::forward: " << e.what());
         return false;
     }
 }
@@ -44,8 +71,7 @@ bool Criterion::operator()(py::object outputs, py::object targets) {
 bool Criterion::forward_distributed(py::object outputs, py::object divided_targets) {
     try {
         // Store outputs and divided targets for later use
-        stored_outputs.push_back(outputs);
-        this->divided_targets.push_back(divided_targets);
+        store_batch(outputs, divided_targets, true);
         
         // For distributed computation, we need to handle the divided targets
         // This is a simplified implementation - in practice, you might need to
@@ -74,7 +100,7 @@ bool Criterion::forward_distributed(py::object outputs, py::object divided_targe
         
         return true;
     } catch (const std::exception& e) {
-        std::cout << "Error in Criterion::forward_distributed: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error in Criterion::forward_distributed: " << e.what());
         return false;
     }
 }
@@ -95,25 +121,53 @@ void Criterion::set_loss(float loss_value) {
     loss = loss_value;
 }
 
-const std::vector<py::object>& Criterion::get_stored_outputs() const {
-    return stored_outputs;
+std::vector<py::object> Criterion::get_stored_outputs() const {
+    std::vector<py::object> outputs;
+    for (const auto& batch : stored_batches) {
+        outputs.push_back(batch.outputs);
+    }
+    return outputs;
 }
 
-const std::vector<py::object>& Criterion::get_stored_targets() const {
-    return stored_targets;
+std::vector<py::object> Criterion::get_stored_targets() const {
+    std::vector<py::object> targets;
+    for (const auto& batch : stored_batches) {
+        if (!batch.divided) {
+            targets.push_back(batch.targets);
+        }
+    }
+    return targets;
 }
 
-const std::vector<py::object>& Criterion::get_divided_targets() const {
-    return divided_targets;
+std::vector<py::object> Criterion::get_divided_targets() const {
+    std::vector<py::object> targets;
+    for (const auto& batch : stored_batches) {
+        if (batch.divided) {
+            targets.push_back(batch.targets);
+        }
+    }
+    return targets;
 }
 
 void Criterion::clear_stored_data() {
-    stored_outputs.clear();
-    stored_targets.clear();
-    divided_targets.clear();
+    stored_batches.clear();
+    stored_bytes = 0;
     loss = 0.0f;
 }
 
+void Criterion::set_max_stored_bytes(size_t max_bytes) {
+    max_stored_bytes = max_bytes;
+    evict_stored_batches();
+}
+
+size_t Criterion::get_max_stored_bytes() const {
+    return max_stored_bytes;
+}
+
+size_t Criterion::get_stored_bytes() const {
+    return stored_bytes;
+}
+
 py::object Criterion::getattr(const std::string& name) {
     return pytorch_criterion.attr(name.c_str());
 }
@@ -154,7 +208,7 @@ std::vector<py::object> Criterion::divide_targets(py::object targets, const std:
         
         return divided_targets;
     } catch (const std::exception& e) {
-        std::cout << "Error in Criterion::divide_targets: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error in Criterion::divide_targets: " << e.what());
         return std::vector<py::object>();
     }
 } 
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <deque>
 
 namespace py = pybind11;
 
@@ -19,9 +20,21 @@ private:
     py::object pytorch_criterion;
     LeafTrainer* leaf_trainer;
     float loss;  // Store the computed loss
-    std::vector<py::object> stored_outputs;
-    std::vector<py::object> stored_targets;
-    std::vector<py::object> divided_targets; // Store divided targets for distributed computation
+
+    // Outputs and targets of recent calls, bounded by max_stored_bytes like Model's outputs
+    struct StoredBatch {
+        py::object outputs;
+        py::object targets;
+        bool divided;  // targets are the per-server divided targets of forward_distributed
+        size_t bytes;
+    };
+    std::deque<StoredBatch> stored_batches;
+    size_t stored_bytes;
+    size_t max_stored_bytes;
+
+    void store_batch(py::object outputs, py::object targets, bool divided);
+    // Drop the oldest batches while over budget, always keeping the newest one
+    void evict_stored_batches();
 
 public:
     Criterion(py::object criterion, LeafTrainer* trainer);
@@ -47,18 +60,23 @@ public:
     // Set the loss value
     void set_loss(float loss_value);
     
-    // Get stored outputs
-    const std::vector<py::object>& get_stored_outputs() const;
+    // Get stored outputs, oldest first
+    std::vector<py::object> get_stored_outputs() const;
     
-    // Get stored targets
-    const std::vector<py::object>& get_stored_targets() const;
+    // Get stored targets of forward calls, oldest first
+    std::vector<py::object> get_stored_targets() const;
     
-    // Get divided targets
-    const std::vector<py::object>& get_divided_targets() const;
+    // Get divided targets of forward_distributed calls, oldest first
+    std::vector<py::object> get_divided_targets() const;
     
     // Clear stored data
     void clear_stored_data();
     
+    // Byte budget for stored outputs and targets; the oldest calls are dropped once it is exceeded
+    void set_max_stored_bytes(size_t max_bytes);
+    size_t get_max_stored_bytes() const;
+    size_t get_stored_bytes() const;
+    
     // Delegate common PyTorch criterion methods
     py::object getattr(const std::string& name);
     
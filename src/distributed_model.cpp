@@ -1,7 +1,8 @@
 #include "distributed_model.h"
 #include "model.h"
 #include "core.h"
-#include <iostream>
+#include "logging.h"
+#include "trace.h"
 #include <stdexcept>
 
 namespace py = pybind11;
@@ -13,9 +14,13 @@ bool DistributedModel::forward(py::object input) {
     // Get server names from trainer
     auto server_names = leaf_trainer->get_server_names();
     if (server_names.empty()) {
-        std::cout << "Error: No servers available for distributed forward" << std::endl;
+        LEAF_LOG_ERROR("No servers available for distributed forward");
         return false;
     }
+    TraceSpan span("forward", "trainer");
+    
+    // One id for every server's share of this step, so each keeps its output for the backward step
+    last_request_id = leaf_trainer->new_request_id();
     
     // Track if all connected servers successfully processed the forward pass
     bool all_success = true;
@@ -29,7 +34,7 @@ bool DistributedModel::forward(py::object input) {
         bool is_connected = server_info["connected"].cast<bool>();
         
         if (!is_connected) {
-            std::cout << "Warning: Server " << server_name << " is not connected, skipping" << std::endl;
+            LEAF_LOG_WARN("Server " << server_name << " is not connected, skipping");
             continue;
         }
         
@@ -37,20 +42,21 @@ bool DistributedModel::forward(py::object input) {
         
         try {
             // Use the model index to perform forward pass on the specific server
-            py::object output = leaf_trainer->forward_pass_on_server(server_name, input, static_cast<uint32_t>(index), is_local);
+            py::object output = leaf_trainer->forward_pass_on_server(server_name, input, static_cast<uint32_t>(index), is_local,
+                                                                     last_request_id);
             successful_servers++;
         } catch (const std::exception& e) {
-            std::cout << "Error on server " << server_name << ": " << e.what() << std::endl;
+            LEAF_LOG_ERROR("Error on server " << server_name << ": " << e.what());
             all_success = false;
         }
     }
     
     if (connected_servers == 0) {
-        std::cout << "Error: No connected servers available for distributed forward" << std::endl;
+        LEAF_LOG_ERROR("No connected servers available for distributed forward");
         return false;
     }
     
-    std::cout << "Distributed forward completed: " << successful_servers << "/" << connected_servers << " servers successful" << std::endl;
+    LEAF_LOG_INFO("Distributed forward completed: " << successful_servers << "/" << connected_servers << " servers successful");
     return all_success;
 }
 
@@ -70,6 +76,10 @@ size_t DistributedModel::get_index() const {
     return index; 
 }
 
+const std::string& DistributedModel::get_last_request_id() const {
+    return last_request_id;
+}
+
 py::object DistributedModel::state_dict() { 
     return model->state_dict(); 
 }
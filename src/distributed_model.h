@@ -18,6 +18,7 @@ private:
     std::shared_ptr<Model> model;
     LeafTrainer* leaf_trainer;
     size_t index; // Index in the distributed_models array
+    std::string last_request_id;  // Id the servers retained the last forward's outputs under
 
 public:
     DistributedModel(std::shared_ptr<Model> model, LeafTrainer* trainer, size_t index);
@@ -33,6 +34,10 @@ public:
     // Get the index of this model in the distributed_models array
     size_t get_index() const;
 
+    // Request id of the last forward pass; the backward step sends it so the servers can release
+    // the outputs they kept for it
+    const std::string& get_last_request_id() const;
+
     // Delegate common PyTorch model methods
     py::object state_dict();
     py::object parameters();
@@ -0,0 +1,327 @@
+#include "flat_optimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LEAF_OPTIMIZER_X86 1
+#endif
+
+OptimizerKind parse_optimizer_kind(const std::string& name) {
+    if (name == "sgd") {
+        return OptimizerKind::SGD;
+    }
+    if (name == "adam") {
+        return OptimizerKind::Adam;
+    }
+    if (name == "adamw") {
+        return OptimizerKind::AdamW;
+    }
+    throw std::invalid_argument("Unknown optimizer '" + name + "' (expected sgd, adam or adamw)");
+}
+
+const char* optimizer_kind_name(OptimizerKind kind) {
+    switch (kind) {
+        case OptimizerKind::SGD: return "sgd";
+        case OptimizerKind::Adam: return "adam";
+        case OptimizerKind::AdamW: return "adamw";
+    }
+    return "unknown";
+}
+
+namespace {
+
+// Per-step scalars shared by every element, computed once in FlatOptimizer::step
+struct StepConstants {
+    float lr;
+    float grad_scale;
+    float l2;          // Weight decay added to the gradient (SGD, Adam)
+    float momentum;
+    bool nesterov;
+    float beta1;
+    float beta2;
+    float epsilon;
+    float step_size;   // lr / (1 - beta1^t)
+    float bias2_rsqrt; // 1 / sqrt(1 - beta2^t)
+    float decay;       // Decoupled weight decay factor 1 - lr * weight_decay (AdamW), else 1
+};
+
+// p -= lr * (g * s + l2 * p)
+void sgd_scalar(float* p, const float* g, float*, float*, size_t n, const StepConstants& c) {
+    for (size_t i = 0; i < n; ++i) {
+        p[i] -= c.lr * (g[i] * c.grad_scale + c.l2 * p[i]);
+    }
+}
+
+// d = g * s + l2 * p; buf = momentum * buf + d; p -= lr * (nesterov ? d + momentum * buf : buf)
+void sgd_momentum_scalar(float* p, const float* g, float* buf, float*, size_t n, const StepConstants& c) {
+    for (size_t i = 0; i < n; ++i) {
+        float d = g[i] * c.grad_scale + c.l2 * p[i];
+        buf[i] = c.momentum * buf[i] + d;
+        p[i] -= c.lr * (c.nesterov ? d + c.momentum * buf[i] : buf[i]);
+    }
+}
+
+// torch.optim.Adam / AdamW: p *= decay; d = g * s + l2 * p; m and v updated with beta1 and beta2;
+// p -= step_size * m / (sqrt(v) * bias2_rsqrt + epsilon)
+void adam_scalar(float* p, const float* g, float* m, float* v, size_t n, const StepConstants& c) {
+    for (size_t i = 0; i < n; ++i) {
+        float param = p[i] * c.decay;
+        float d = g[i] * c.grad_scale + c.l2 * param;
+        m[i] = c.beta1 * m[i] + (1.0f - c.beta1) * d;
+        v[i] = c.beta2 * v[i] + (1.0f - c.beta2) * d * d;
+        p[i] = param - c.step_size * m[i] / (std::sqrt(v[i]) * c.bias2_rsqrt + c.epsilon);
+    }
+}
+
+#ifdef LEAF_OPTIMIZER_X86
+
+__attribute__((target("avx2,fma")))
+void sgd_avx2(float* p, const float* g, float* buf, float* unused, size_t n, const StepConstants& c) {
+    const __m256 lr = _mm256_set1_ps(c.lr);
+    const __m256 scale = _mm256_set1_ps(c.grad_scale);
+    const __m256 l2 = _mm256_set1_ps(c.l2);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 param = _mm256_loadu_ps(p + i);
+        __m256 d = _mm256_fmadd_ps(_mm256_loadu_ps(g + i), scale, _mm256_mul_ps(l2, param));
+        _mm256_storeu_ps(p + i, _mm256_fnmadd_ps(lr, d, param));
+    }
+    sgd_scalar(p + i, g + i, buf, unused, n - i, c);
+}
+
+__attribute__((target("avx2,fma")))
+void sgd_momentum_avx2(float* p, const float* g, float* buf, float* unused, size_t n, const StepConstants& c) {
+    const __m256 lr = _mm256_set1_ps(c.lr);
+    const __m256 scale = _mm256_set1_ps(c.grad_scale);
+    const __m256 l2 = _mm256_set1_ps(c.l2);
+    const __m256 momentum = _mm256_set1_ps(c.momentum);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 param = _mm256_loadu_ps(p + i);
+        __m256 d = _mm256_fmadd_ps(_mm256_loadu_ps(g + i), scale, _mm256_mul_ps(l2, param));
+        __m256 b = _mm256_fmadd_ps(momentum, _mm256_loadu_ps(buf + i), d);
+        _mm256_storeu_ps(buf + i, b);
+        __m256 update = c.nesterov ? _mm256_fmadd_ps(momentum, b, d) : b;
+        _mm256_storeu_ps(p + i, _mm256_fnmadd_ps(lr, update, param));
+    }
+    sgd_momentum_scalar(p + i, g + i, buf + i, unused, n - i, c);
+}
+
+__attribute__((target("avx2,fma")))
+void adam_avx2(float* p, const float* g, float* m, float* v, size_t n, const StepConstants& c) {
+    const __m256 scale = _mm256_set1_ps(c.grad_scale);
+    const __m256 l2 = _mm256_set1_ps(c.l2);
+    const __m256 beta1 = _mm256_set1_ps(c.beta1);
+    const __m256 beta2 = _mm256_set1_ps(c.beta2);
+    const __m256 one_minus_beta1 = _mm256_set1_ps(1.0f - c.beta1);
+    const __m256 one_minus_beta2 = _mm256_set1_ps(1.0f - c.beta2);
+    const __m256 epsilon = _mm256_set1_ps(c.epsilon);
+    const __m256 step_size = _mm256_set1_ps(c.step_size);
+    const __m256 bias2_rsqrt = _mm256_set1_ps(c.bias2_rsqrt);
+    const __m256 decay = _mm256_set1_ps(c.decay);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 param = _mm256_mul_ps(_mm256_loadu_ps(p + i), decay);
+        __m256 d = _mm256_fmadd_ps(_mm256_loadu_ps(g + i), scale, _mm256_mul_ps(l2, param));
+        __m256 m1 = _mm256_fmadd_ps(beta1, _mm256_loadu_ps(m + i), _mm256_mul_ps(one_minus_beta1, d));
+        __m256 v1 = _mm256_fmadd_ps(beta2, _mm256_loadu_ps(v + i), _mm256_mul_ps(_mm256_mul_ps(one_minus_beta2, d), d));
+        _mm256_storeu_ps(m + i, m1);
+        _mm256_storeu_ps(v + i, v1);
+        __m256 denom = _mm256_fmadd_ps(_mm256_sqrt_ps(v1), bias2_rsqrt, epsilon);
+        _mm256_storeu_ps(p + i, _mm256_fnmadd_ps(step_size, _mm256_div_ps(m1, denom), param));
+    }
+    adam_scalar(p + i, g + i, m + i, v + i, n - i, c);
+}
+
+__attribute__((target("avx512f")))
+void sgd_avx512(float* p, const float* g, float* buf, float* unused, size_t n, const StepConstants& c) {
+    const __m512 lr = _mm512_set1_ps(c.lr);
+    const __m512 scale = _mm512_set1_ps(c.grad_scale);
+    const __m512 l2 = _mm512_set1_ps(c.l2);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 param = _mm512_loadu_ps(p + i);
+        __m512 d = _mm512_fmadd_ps(_mm512_loadu_ps(g + i), scale, _mm512_mul_ps(l2, param));
+        _mm512_storeu_ps(p + i, _mm512_fnmadd_ps(lr, d, param));
+    }
+    sgd_scalar(p + i, g + i, buf, unused, n - i, c);
+}
+
+__attribute__((target("avx512f")))
+void sgd_momentum_avx512(float* p, const float* g, float* buf, float* unused, size_t n, const StepConstants& c) {
+    const __m512 lr = _mm512_set1_ps(c.lr);
+    const __m512 scale = _mm512_set1_ps(c.grad_scale);
+    const __m512 l2 = _mm512_set1_ps(c.l2);
+    const __m512 momentum = _mm512_set1_ps(c.momentum);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 param = _mm512_loadu_ps(p + i);
+        __m512 d = _mm512_fmadd_ps(_mm512_loadu_ps(g + i), scale, _mm512_mul_ps(l2, param));
+        __m512 b = _mm512_fmadd_ps(momentum, _mm512_loadu_ps(buf + i), d);
+        _mm512_storeu_ps(buf + i, b);
+        __m512 update = c.nesterov ? _mm512_fmadd_ps(momentum, b, d) : b;
+        _mm512_storeu_ps(p + i, _mm512_fnmadd_ps(lr, update, param));
+    }
+    sgd_momentum_scalar(p + i, g + i, buf + i, unused, n - i, c);
+}
+
+__attribute__((target("avx512f")))
+void adam_avx512(float* p, const float* g, float* m, float* v, size_t n, const StepConstants& c) {
+    const __m512 scale = _mm512_set1_ps(c.grad_scale);
+    const __m512 l2 = _mm512_set1_ps(c.l2);
+    const __m512 beta1 = _mm512_set1_ps(c.beta1);
+    const __m512 beta2 = _mm512_set1_ps(c.beta2);
+    const __m512 one_minus_beta1 = _mm512_set1_ps(1.0f - c.beta1);
+    const __m512 one_minus_beta2 = _mm512_set1_ps(1.0f - c.beta2);
+    const __m512 epsilon = _mm512_set1_ps(c.epsilon);
+    const __m512 step_size = _mm512_set1_ps(c.step_size);
+    const __m512 bias2_rsqrt = _mm512_set1_ps(c.bias2_rsqrt);
+    const __m512 decay = _mm512_set1_ps(c.decay);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 param = _mm512_mul_ps(_mm512_loadu_ps(p + i), decay);
+        __m512 d = _mm512_fmadd_ps(_mm512_loadu_ps(g + i), scale, _mm512_mul_ps(l2, param));
+        __m512 m1 = _mm512_fmadd_ps(beta1, _mm512_loadu_ps(m + i), _mm512_mul_ps(one_minus_beta1, d));
+        __m512 v1 = _mm512_fmadd_ps(beta2, _mm512_loadu_ps(v + i), _mm512_mul_ps(_mm512_mul_ps(one_minus_beta2, d), d));
+        _mm512_storeu_ps(m + i, m1);
+        _mm512_storeu_ps(v + i, v1);
+        __m512 denom = _mm512_fmadd_ps(_mm512_sqrt_ps(v1), bias2_rsqrt, epsilon);
+        _mm512_storeu_ps(p + i, _mm512_fnmadd_ps(step_size, _mm512_div_ps(m1, denom), param));
+    }
+    adam_scalar(p + i, g + i, m + i, v + i, n - i, c);
+}
+
+#endif // LEAF_OPTIMIZER_X86
+
+using Kernel = void (*)(float*, const float*, float*, float*, size_t, const StepConstants&);
+
+struct Kernels {
+    const char* isa;
+    Kernel sgd;
+    Kernel sgd_momentum;
+    Kernel adam;
+};
+
+// The widest kernels this CPU runs, optionally capped by LEAF_OPTIMIZER_ISA=scalar|avx2|avx512
+// to compare them
+Kernels select_kernels() {
+    const char* cap = std::getenv("LEAF_OPTIMIZER_ISA");
+    std::string limit = cap ? cap : "avx512";
+#ifdef LEAF_OPTIMIZER_X86
+    __builtin_cpu_init();
+    if (limit == "avx512" && __builtin_cpu_supports("avx512f")) {
+        return {"avx512", sgd_avx512, sgd_momentum_avx512, adam_avx512};
+    }
+    if (limit != "scalar" && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return {"avx2", sgd_avx2, sgd_momentum_avx2, adam_avx2};
+    }
+#endif
+    return {"scalar", sgd_scalar, sgd_momentum_scalar, adam_scalar};
+}
+
+const Kernels& kernels() {
+    static const Kernels selected = select_kernels();
+    return selected;
+}
+
+// Below this many elements per thread, starting a thread costs more than the update it takes over
+constexpr size_t min_elements_per_thread = 1 << 16;
+
+// CPUs this process may run on, which is fewer than the machine's when a server is pinned to a slice
+size_t usable_cpus() {
+#ifdef __linux__
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    if (sched_getaffinity(0, sizeof(affinity), &affinity) == 0) {
+        return static_cast<size_t>(CPU_COUNT(&affinity));
+    }
+#endif
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // namespace
+
+const char* optimizer_isa() {
+    return kernels().isa;
+}
+
+FlatOptimizer::FlatOptimizer(const OptimizerOptions& optimizer_options, size_t parameter_count)
+    : options(optimizer_options), count(parameter_count) {
+    if (options.kind == OptimizerKind::SGD) {
+        if (options.momentum != 0.0f) {
+            first_moment.assign(count, 0.0f);
+        }
+    } else {
+        first_moment.assign(count, 0.0f);
+        second_moment.assign(count, 0.0f);
+    }
+}
+
+void FlatOptimizer::step(float* parameters, const float* gradients, size_t gradient_count, float grad_scale) {
+    if (gradient_count != count) {
+        throw std::invalid_argument("Optimizer holds state for " + std::to_string(count) + " parameters, got " +
+                                    std::to_string(gradient_count) + " gradients");
+    }
+    ++steps;
+
+    StepConstants c{};
+    c.lr = options.learning_rate;
+    c.grad_scale = grad_scale;
+    c.momentum = options.momentum;
+    c.nesterov = options.nesterov;
+    c.beta1 = options.beta1;
+    c.beta2 = options.beta2;
+    c.epsilon = options.epsilon;
+    c.decay = 1.0f;
+    Kernel kernel;
+    if (options.kind == OptimizerKind::SGD) {
+        c.l2 = options.weight_decay;
+        kernel = first_moment.empty() ? kernels().sgd : kernels().sgd_momentum;
+    } else {
+        // Bias corrections in double so they stay accurate over many steps
+        double t = static_cast<double>(steps);
+        c.step_size = static_cast<float>(options.learning_rate / (1.0 - std::pow(options.beta1, t)));
+        c.bias2_rsqrt = static_cast<float>(1.0 / std::sqrt(1.0 - std::pow(options.beta2, t)));
+        if (options.kind == OptimizerKind::AdamW) {
+            c.l2 = 0.0f;
+            c.decay = 1.0f - options.learning_rate * options.weight_decay;
+        } else {
+            c.l2 = options.weight_decay;
+        }
+        kernel = kernels().adam;
+    }
+
+    float* m = first_moment.empty() ? nullptr : first_moment.data();
+    float* v = second_moment.empty() ? nullptr : second_moment.data();
+    size_t threads = options.threads;
+    if (threads == 0) {
+        threads = count < 2 * min_elements_per_thread ? 1 : std::min(usable_cpus(), count / min_elements_per_thread);
+    }
+    threads = std::max<size_t>(1, std::min(threads, count));
+    if (threads == 1) {
+        kernel(parameters, gradients, m, v, count, c);
+        return;
+    }
+
+    // Contiguous slices in multiples of 16 floats so only the last one has a scalar tail
+    size_t per_thread = (count / threads + 15) & ~static_cast<size_t>(15);
+    auto run = [&](size_t begin) {
+        size_t n = std::min(per_thread, count - begin);
+        kernel(parameters + begin, gradients + begin, m ? m + begin : nullptr, v ? v + begin : nullptr, n, c);
+    };
+    std::vector<std::thread> workers;
+    for (size_t begin = per_thread; begin < count; begin += per_thread) {
+        workers.emplace_back(run, begin);
+    }
+    run(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef FLAT_OPTIMIZER_H
+#define FLAT_OPTIMIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class OptimizerKind { SGD, Adam, AdamW };
+
+// Parses "sgd", "adam" or "adamw"; throws std::invalid_argument otherwise
+OptimizerKind parse_optimizer_kind(const std::string& name);
+const char* optimizer_kind_name(OptimizerKind kind);
+
+// Hyperparameters with torch.optim's defaults and meaning. weight_decay is an L2 term added to the
+// gradient for SGD and Adam, and decoupled (parameters shrunk by lr * weight_decay) for AdamW.
+struct OptimizerOptions {
+    OptimizerKind kind = OptimizerKind::SGD;
+    float learning_rate = 0.01f;
+    float momentum = 0.0f;    // SGD
+    bool nesterov = false;    // SGD
+    float beta1 = 0.9f;       // Adam, AdamW
+    float beta2 = 0.999f;     // Adam, AdamW
+    float epsilon = 1e-8f;    // Adam, AdamW
+    float weight_decay = 0.0f;
+    unsigned threads = 0;     // Threads per step; 0 picks from the buffer size and the hardware
+};
+
+// Instruction set the kernels were dispatched to on this CPU: "avx512", "avx2" or "scalar"
+const char* optimizer_isa();
+
+// Applies an optimizer in place to one flat parameter buffer, e.g. Model::serialize_state's
+// layout or a parameter server's shard, keeping the optimizer state (momentum, Adam moments) for
+// that buffer. Kernels use AVX-512 or AVX2 with FMA when the CPU has them and large buffers are
+// split across threads. Not thread-safe: one step at a time per optimizer.
+class FlatOptimizer {
+private:
+    OptimizerOptions options;
+    size_t count;
+    uint64_t steps = 0;
+    std::vector<float> first_moment;   // SGD momentum buffer or Adam's m; empty if unused
+    std::vector<float> second_moment;  // Adam's v; empty if unused
+
+public:
+    FlatOptimizer(const OptimizerOptions& optimizer_options, size_t parameter_count);
+
+    // One update of count parameters from gradients multiplied by grad_scale (e.g. 1 / workers to
+    // average summed gradients). Throws std::invalid_argument if count differs from the buffer's.
+    void step(float* parameters, const float* gradients, size_t count, float grad_scale = 1.0f);
+
+    const OptimizerOptions& get_options() const { return options; }
+    size_t size() const { return count; }
+    uint64_t get_steps() const { return steps; }
+};
+
+#endif // FLAT_OPTIMIZER_H
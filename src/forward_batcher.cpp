@@ -0,0 +1,218 @@
+#include "forward_batcher.h"
+#include "metrics.h"
+#include "trace.h"
+#include "logging.h"
+#include <Python.h>
+#include <algorithm>
+#include <optional>
+
+namespace py = pybind11;
+
+// Where a forward request's time goes: waiting for a batch leader, waiting for the GIL, turning
+// request bytes into tensors, running the model in Python and copying the output into responses
+struct BatcherMetrics {
+    Histogram& queue_wait_us = metrics().histogram("forward.queue_wait_us");
+    Histogram& batch_size = metrics().histogram("forward.batch_size");
+    Histogram& gil_wait_us = metrics().histogram("forward.gil_wait_us");
+    Histogram& deserialize_us = metrics().histogram("forward.deserialize_us");
+    Histogram& python_us = metrics().histogram("forward.python_us");
+    Histogram& serialize_us = metrics().histogram("forward.serialize_us");
+};
+
+static BatcherMetrics& batcher_metrics() {
+    static BatcherMetrics instance;
+    return instance;
+}
+
+ForwardBatcher::ForwardBatcher(const BatchingOptions& opts) : options(opts) {
+    if (options.max_batch_size == 0) {
+        options.max_batch_size = 1;
+    }
+}
+
+// Per-sample shape of a request, used to decide which requests can share a batch
+static std::string batch_key(const std::string& model_id, const leaftest::ForwardPassRequest& request) {
+    std::string key = model_id + ":";
+    if (request.input_shape_size() == 0) {
+        return key + std::to_string(request.input_data().size());
+    }
+    for (int i = 1; i < request.input_shape_size(); ++i) {
+        key += std::to_string(request.input_shape(i)) + "x";
+    }
+    return key;
+}
+
+void ForwardBatcher::submit(const std::string& model_id,
+                            const std::shared_ptr<Model>& model,
+                            const leaftest::ForwardPassRequest& request,
+                            leaftest::ForwardPassResponse* response) {
+    // Waiting for other requests while holding the GIL would stall the leader that needs it
+    std::optional<py::gil_scoped_release> release;
+    if (Py_IsInitialized() && PyGILState_Check()) {
+        release.emplace();
+    }
+
+    // Only inputs with the same per-sample shape can be concatenated into one batch
+    std::string key = batch_key(model_id, request);
+    PendingRequest pending_request{&request, response, std::chrono::steady_clock::now()};
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto queue_it = queues.try_emplace(key).first;
+    BatchQueue& queue = queue_it->second;
+    queue.callers++;
+    queue.pending.push_back(&pending_request);
+    queue.cv.notify_all();
+
+    while (!pending_request.done) {
+        if (queue.leader_active) {
+            queue.cv.wait(lock);
+            continue;
+        }
+
+        // Become the leader: give other callers up to max_delay to join the batch
+        queue.leader_active = true;
+        auto deadline = std::chrono::steady_clock::now() + options.max_delay;
+        while (queue.pending.size() < options.max_batch_size &&
+               std::chrono::steady_clock::now() < deadline) {
+            queue.cv.wait_until(lock, deadline);
+        }
+
+        size_t batch_size = std::min(queue.pending.size(), options.max_batch_size);
+        std::vector<PendingRequest*> batch(queue.pending.begin(), queue.pending.begin() + batch_size);
+        queue.pending.erase(queue.pending.begin(), queue.pending.begin() + batch_size);
+        int64_t now_us = trace_now_us();
+        for (PendingRequest* pending : batch) {
+            uint64_t waited_us = microseconds_since(pending->enqueued);
+            batcher_metrics().queue_wait_us.record(waited_us);
+            if (pending->request->trace()) {
+                add_trace_event(pending->response->mutable_trace_events(), "queue", "server",
+                                now_us - static_cast<int64_t>(waited_us), now_us);
+            }
+        }
+        batcher_metrics().batch_size.record(batch_size);
+
+        lock.unlock();
+        run_batch(model, batch);
+        lock.lock();
+
+        for (PendingRequest* pending : batch) {
+            pending->done = true;
+        }
+        queue.leader_active = false;
+        queue.cv.notify_all();
+    }
+    if (--queue.callers == 0) {
+        queues.erase(queue_it);
+    }
+}
+
+void ForwardBatcher::run_batch(const std::shared_ptr<Model>& model, const std::vector<PendingRequest*>& batch) {
+    BatcherMetrics& stats = batcher_metrics();
+    bool traced = std::any_of(batch.begin(), batch.end(),
+                              [](const PendingRequest* pending) { return pending->request->trace(); });
+    auto stage_start = std::chrono::steady_clock::now();
+    // Record a stage that began at stage_start, also as a span of every request that asked for a trace
+    auto finish_stage = [&](Histogram& histogram, const char* name) {
+        uint64_t elapsed_us = microseconds_since(stage_start);
+        histogram.record(elapsed_us);
+        if (traced) {
+            int64_t end_us = trace_now_us();
+            for (PendingRequest* pending : batch) {
+                if (pending->request->trace()) {
+                    add_trace_event(pending->response->mutable_trace_events(), name, "server",
+                                    end_us - static_cast<int64_t>(elapsed_us), end_us);
+                }
+            }
+        }
+        stage_start = std::chrono::steady_clock::now();
+    };
+
+    py::gil_scoped_acquire gil;
+    finish_stage(stats.gil_wait_us, "GIL wait");
+    try {
+        py::object numpy = py::module_::import("numpy");
+        py::object torch = py::module_::import("torch");
+        py::object np_float32 = numpy.attr("dtype")("float32");
+
+        // Build one tensor per request, treating flat inputs without a shape as a single sample
+        py::list inputs;
+        std::vector<int64_t> rows;
+        int64_t total_rows = 0;
+        for (PendingRequest* pending : batch) {
+            const leaftest::ForwardPassRequest& request = *pending->request;
+            py::object input_array = numpy.attr("frombuffer")(py::bytes(request.input_data()), np_float32);
+            py::object input_tensor = torch.attr("from_numpy")(input_array).attr("float")();
+            if (request.input_shape_size() > 0) {
+                py::tuple shape(request.input_shape_size());
+                for (int i = 0; i < request.input_shape_size(); ++i) {
+                    shape[i] = py::int_(request.input_shape(i));
+                }
+                input_tensor = input_tensor.attr("reshape")(shape);
+            } else if (input_tensor.attr("dim")().cast<int>() == 1) {
+                input_tensor = input_tensor.attr("unsqueeze")(0);
+            }
+            int64_t request_rows = input_tensor.attr("shape").attr("__getitem__")(0).cast<int64_t>();
+            rows.push_back(request_rows);
+            total_rows += request_rows;
+            inputs.append(input_tensor);
+        }
+
+        py::object batch_input = batch.size() == 1 ? py::object(inputs[0]) : torch.attr("cat")(inputs, 0);
+        finish_stage(stats.deserialize_us, "deserialize");
+
+        py::object pytorch_model = model->get_pytorch_model();
+        py::object output_tensor = pytorch_model.attr("forward")(batch_input);
+        finish_stage(stats.python_us, "forward");
+        if (!py::hasattr(output_tensor, "detach")) {
+            throw std::runtime_error("Model output is not a tensor");
+        }
+
+        // One contiguous float32 view of the output; each response copies its rows straight out of it
+        output_tensor = output_tensor.attr("detach")().attr("to")(py::str("cpu"), torch.attr("float32")).attr("contiguous")();
+        py::array_t<float, py::array::c_style> output_array = output_tensor.attr("numpy")();
+        if (output_array.ndim() == 0 || output_array.shape(0) != total_rows) {
+            throw std::runtime_error("Batched output has " +
+                                     std::to_string(output_array.ndim() == 0 ? 0 : output_array.shape(0)) +
+                                     " rows, expected " + std::to_string(total_rows));
+        }
+        size_t row_elems = total_rows > 0 ? static_cast<size_t>(output_array.size() / total_rows) : 0;
+
+        if (batch.size() > 1) {
+            LEAF_LOG_DEBUG("ForwardBatcher: Ran " << batch.size() << " requests (" << total_rows
+                           << " samples) in one forward pass");
+        }
+
+        const float* output_data = output_array.data();
+        size_t row_offset = 0;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            leaftest::ForwardPassResponse* response = batch[i]->response;
+            const float* begin = output_data + row_offset * row_elems;
+            response->set_output_data(begin, rows[i] * row_elems * sizeof(float));
+            response->clear_output_shape();
+            response->add_output_shape(rows[i]);
+            for (py::ssize_t dim = 1; dim < output_array.ndim(); ++dim) {
+                response->add_output_shape(output_array.shape(dim));
+            }
+            response->set_output_dtype("float32");
+            response->set_success(true);
+            response->set_error_message("");
+            row_offset += rows[i];
+        }
+        finish_stage(stats.serialize_us, "serialize");
+    } catch (const std::exception& e) {
+        LEAF_LOG_ERROR("ForwardBatcher: Forward pass failed: " << e.what());
+        for (PendingRequest* pending : batch) {
+            pending->response->set_success(false);
+            pending->response->set_error_message("Forward pass failed: " + std::string(e.what()));
+        }
+    }
+}
+
+size_t ForwardBatcher::queue_depth() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t depth = 0;
+    for (const auto& [key, queue] : queues) {
+        depth += queue.pending.size();
+    }
+    return depth;
+}
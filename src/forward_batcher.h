@@ -0,0 +1,72 @@
+#ifndef FORWARD_BATCHER_H
+#define FORWARD_BATCHER_H
+
+#include <pybind11/pybind11.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "server_communication.pb.h"
+#include "model.h"
+
+namespace py = pybind11;
+
+struct BatchingOptions {
+    size_t max_batch_size = 32;                  // Upper bound on requests fused into one forward call
+    std::chrono::microseconds max_delay{0};      // How long a batch leader waits for more requests
+};
+
+// Coalesces concurrent ForwardPass requests for the same model into one batched forward call.
+//
+// The first request to arrive for a model becomes the batch leader: it waits up to max_delay (or
+// until max_batch_size requests are queued), concatenates the queued inputs along the batch
+// dimension, runs a single forward under the GIL and scatters the output rows back to each
+// request's response. Requests that arrive while a batch is running are picked up by the next
+// leader, so even with a zero delay concurrent callers are batched together instead of running
+// one forward each.
+class ForwardBatcher {
+private:
+    struct PendingRequest {
+        const leaftest::ForwardPassRequest* request;
+        leaftest::ForwardPassResponse* response;
+        std::chrono::steady_clock::time_point enqueued;
+        bool done = false;
+    };
+
+    struct BatchQueue {
+        std::deque<PendingRequest*> pending;
+        bool leader_active = false;
+        size_t callers = 0;          // Requests inside submit(); the last one out erases the queue
+        std::condition_variable cv;  // Signals new arrivals to the leader and completions to followers
+    };
+
+    BatchingOptions options;
+    mutable std::mutex mutex;
+    // Keyed by model id and per-sample input shape; a queue only exists while a request for it is
+    // in submit(), so models and shapes that stop arriving cost nothing
+    std::map<std::string, BatchQueue> queues;
+
+    void run_batch(const std::shared_ptr<Model>& model, const std::vector<PendingRequest*>& batch);
+
+public:
+    explicit ForwardBatcher(const BatchingOptions& opts = BatchingOptions());
+
+    // Blocks until this request has been served as part of a batch. On success the response holds
+    // this request's rows of the batched output, written straight from the output tensor.
+    void submit(const std::string& model_id,
+                const std::shared_ptr<Model>& model,
+                const leaftest::ForwardPassRequest& request,
+                leaftest::ForwardPassResponse* response);
+
+    // Number of requests currently waiting for a batch leader
+    size_t queue_depth() const;
+
+    const BatchingOptions& get_options() const { return options; }
+};
+
+#endif // FORWARD_BATCHER_H
@@ -0,0 +1,154 @@
+#include "heartbeat_monitor.h"
+#include "server_communication.grpc.pb.h"
+#include "logging.h"
+
+HeartbeatMonitor::CallGuard::CallGuard(HeartbeatMonitor& heartbeat_monitor, const std::string& server_name,
+                                       grpc::ClientContext* call_context)
+    : monitor(heartbeat_monitor), server(server_name), context(call_context) {
+    std::lock_guard<std::mutex> lock(monitor.mutex);
+    monitor.calls.emplace(server, context);
+}
+
+HeartbeatMonitor::CallGuard::~CallGuard() {
+    std::lock_guard<std::mutex> lock(monitor.mutex);
+    auto range = monitor.calls.equal_range(server);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == context) {
+            monitor.calls.erase(it);
+            break;
+        }
+    }
+}
+
+HeartbeatMonitor::HeartbeatMonitor() : running(false), interval(1000) {}
+
+HeartbeatMonitor::~HeartbeatMonitor() {
+    stop();
+}
+
+void HeartbeatMonitor::start(const std::vector<std::string>& servers, ChannelFactory channel_factory,
+                             std::chrono::milliseconds heartbeat_interval) {
+    stop();
+    std::lock_guard<std::mutex> lock(mutex);
+    running = true;
+    interval = heartbeat_interval;
+    status.clear();
+    // Servers get a few seconds to answer the first heartbeat, since the stream is still opening
+    auto grace = std::chrono::steady_clock::now() + std::max<std::chrono::milliseconds>(interval, std::chrono::seconds(5));
+    for (const auto& server : servers) {
+        auto stream = std::make_unique<Stream>();
+        stream->server = server;
+        stream->channel = channel_factory(server);
+        status[server].last_seen = grace;
+        stream->thread = std::thread(&HeartbeatMonitor::read_stream, this, stream.get());
+        streams.push_back(std::move(stream));
+    }
+    watchdog = std::thread(&HeartbeatMonitor::watch, this);
+}
+
+void HeartbeatMonitor::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!running) {
+            return;
+        }
+        running = false;
+        for (auto& stream : streams) {
+            if (stream->context) {
+                stream->context->TryCancel();
+            }
+        }
+    }
+    stop_cv.notify_all();
+    for (auto& stream : streams) {
+        stream->thread.join();
+    }
+    watchdog.join();
+    std::lock_guard<std::mutex> lock(mutex);
+    streams.clear();
+}
+
+bool HeartbeatMonitor::is_running() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return running;
+}
+
+bool HeartbeatMonitor::is_alive(const std::string& server) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = status.find(server);
+    return it == status.end() || it->second.alive;
+}
+
+std::map<std::string, ServerHeartbeat> HeartbeatMonitor::get_status() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return status;
+}
+
+void HeartbeatMonitor::read_stream(Stream* stream) {
+    auto stub = leaftest::ServerCommunication::NewStub(stream->channel);
+    while (true) {
+        grpc::ClientContext context;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) {
+                return;
+            }
+            stream->context = &context;
+        }
+        leaftest::HeartbeatRequest request;
+        request.set_interval_ms(static_cast<uint32_t>(interval.count()));
+        auto reader = stub->Heartbeat(&context, request);
+
+        leaftest::HeartbeatResponse heartbeat;
+        while (reader->Read(&heartbeat)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& server = status[stream->server];
+            if (!server.alive) {
+                LEAF_LOG_INFO("Heartbeat: server " << stream->server << " is responding again");
+            }
+            server.alive = true;
+            server.received = true;
+            server.error.clear();
+            server.last_seen = std::chrono::steady_clock::now();
+            server.latest = heartbeat;
+        }
+        grpc::Status result = reader->Finish();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        stream->context = nullptr;
+        if (!running) {
+            return;
+        }
+        declare_dead(stream->server, "Heartbeat stream ended: " +
+                     (result.ok() ? std::string("server closed it") : result.error_message()));
+        // Reconnect after an interval; the server may only have restarted
+        stop_cv.wait_for(lock, interval, [this] { return !running; });
+    }
+}
+
+void HeartbeatMonitor::watch() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (running) {
+        // Check twice per interval so a silent server is caught soon after its deadline
+        stop_cv.wait_for(lock, interval / 2, [this] { return !running; });
+        auto deadline = std::chrono::steady_clock::now() - 2 * interval;
+        for (auto& [server, heartbeat] : status) {
+            if (heartbeat.alive && heartbeat.last_seen < deadline) {
+                declare_dead(server, "No heartbeat for " + std::to_string(2 * interval.count()) + "ms");
+            }
+        }
+    }
+}
+
+void HeartbeatMonitor::declare_dead(const std::string& server, const std::string& reason) {
+    auto& heartbeat = status[server];
+    if (heartbeat.alive) {
+        LEAF_LOG_WARN("Heartbeat: server " << server << " declared dead: " << reason);
+    }
+    heartbeat.alive = false;
+    heartbeat.error = reason;
+    auto range = calls.equal_range(server);
+    for (auto it = range.first; it != range.second; ++it) {
+        it->second->TryCancel();
+    }
+}
@@ -0,0 +1,86 @@
+#ifndef HEARTBEAT_MONITOR_H
+#define HEARTBEAT_MONITOR_H
+
+#include <grpcpp/grpcpp.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "server_communication.pb.h"
+
+// Latest heartbeat of a server and whether it is still considered alive
+struct ServerHeartbeat {
+    bool alive = true;
+    bool received = false;  // At least one heartbeat arrived
+    std::chrono::steady_clock::time_point last_seen;
+    leaftest::HeartbeatResponse latest;
+    std::string error;      // Why the server was declared dead
+};
+
+// Subscribes to every server's Heartbeat stream and declares a server dead once its stream breaks
+// or no heartbeat arrives for two intervals. Calls registered through CallGuard are cancelled
+// when their server dies, so callers fail within a heartbeat instead of at their RPC deadline.
+// A dead server's stream is re-opened every interval, and it is alive again once one arrives.
+class HeartbeatMonitor {
+public:
+    using ChannelFactory = std::function<std::shared_ptr<grpc::Channel>(const std::string&)>;
+
+    // Cancels the call if its server is declared dead while the guard is in scope
+    class CallGuard {
+    private:
+        HeartbeatMonitor& monitor;
+        std::string server;
+        grpc::ClientContext* context;
+
+    public:
+        CallGuard(HeartbeatMonitor& heartbeat_monitor, const std::string& server_name, grpc::ClientContext* call_context);
+        ~CallGuard();
+        CallGuard(const CallGuard&) = delete;
+        CallGuard& operator=(const CallGuard&) = delete;
+    };
+
+    HeartbeatMonitor();
+    ~HeartbeatMonitor();
+
+    HeartbeatMonitor(const HeartbeatMonitor&) = delete;
+    HeartbeatMonitor& operator=(const HeartbeatMonitor&) = delete;
+
+    // Start monitoring the servers, replacing any previous set
+    void start(const std::vector<std::string>& servers, ChannelFactory channel_factory,
+               std::chrono::milliseconds heartbeat_interval);
+    void stop();
+    bool is_running() const;
+
+    // False while the server is declared dead; servers that are not monitored count as alive
+    bool is_alive(const std::string& server) const;
+    std::map<std::string, ServerHeartbeat> get_status() const;
+
+private:
+    struct Stream {
+        std::string server;
+        std::shared_ptr<grpc::Channel> channel;
+        grpc::ClientContext* context = nullptr;  // Current call, guarded by mutex
+        std::thread thread;
+    };
+
+    mutable std::mutex mutex;
+    std::condition_variable stop_cv;
+    bool running;
+    std::chrono::milliseconds interval;
+    std::map<std::string, ServerHeartbeat> status;
+    std::multimap<std::string, grpc::ClientContext*> calls;
+    std::vector<std::unique_ptr<Stream>> streams;
+    std::thread watchdog;
+
+    void read_stream(Stream* stream);
+    void watch();
+    // Caller holds mutex
+    void declare_dead(const std::string& server, const std::string& reason);
+};
+
+#endif // HEARTBEAT_MONITOR_H
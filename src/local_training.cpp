@@ -0,0 +1,264 @@
+#include "local_training.h"
+#include <pybind11/numpy.h>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+// Elements in one row of a tensor whose shape starts with the batch dimension
+static size_t row_elements(const std::vector<int64_t>& shape) {
+    size_t elements = 1;
+    for (size_t dim = 1; dim < shape.size(); ++dim) {
+        elements *= static_cast<size_t>(shape[dim]);
+    }
+    return elements;
+}
+
+size_t DataShardStore::store(const std::string& shard_id, bool append, const std::vector<int64_t>& input_shape,
+                             const std::string& inputs, const std::vector<int64_t>& target_shape,
+                             const std::string& targets, bool integer_targets) {
+    if (input_shape.empty() || target_shape.empty() || input_shape[0] != target_shape[0]) {
+        throw std::invalid_argument("Inputs and targets need shapes with the same number of rows");
+    }
+    size_t rows = static_cast<size_t>(input_shape[0]);
+    size_t target_size = integer_targets ? sizeof(int64_t) : sizeof(float);
+    if (inputs.size() != rows * row_elements(input_shape) * sizeof(float) ||
+        targets.size() != rows * row_elements(target_shape) * target_size) {
+        throw std::invalid_argument("Data shard " + shard_id + ": " + std::to_string(rows) +
+                                    " rows do not match the input or target bytes");
+    }
+    std::vector<int64_t> input_row_shape(input_shape.begin() + 1, input_shape.end());
+    std::vector<int64_t> target_row_shape(target_shape.begin() + 1, target_shape.end());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = shards.find(shard_id);
+    if (!append || it == shards.end()) {
+        it = shards.insert_or_assign(shard_id, DataShard()).first;
+        it->second.input_row_shape = input_row_shape;
+        it->second.target_row_shape = target_row_shape;
+        it->second.integer_targets = integer_targets;
+    } else if (it->second.input_row_shape != input_row_shape || it->second.target_row_shape != target_row_shape ||
+               it->second.integer_targets != integer_targets) {
+        throw std::invalid_argument("Rows appended to data shard " + shard_id + " differ in shape or target type");
+    }
+    DataShard& shard = it->second;
+    const float* input_data = reinterpret_cast<const float*>(inputs.data());
+    shard.inputs.insert(shard.inputs.end(), input_data, input_data + inputs.size() / sizeof(float));
+    shard.targets.append(targets);
+    shard.rows += rows;
+    return shard.rows;
+}
+
+size_t DataShardStore::rows(const std::string& shard_id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = shards.find(shard_id);
+    if (it == shards.end()) {
+        throw std::runtime_error("No data shard " + shard_id);
+    }
+    return it->second.rows;
+}
+
+std::pair<py::object, py::object> DataShardStore::batch(const std::string& shard_id,
+                                                        const std::vector<size_t>& row_indices) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = shards.find(shard_id);
+    if (it == shards.end()) {
+        throw std::runtime_error("No data shard " + shard_id);
+    }
+    const DataShard& shard = it->second;
+    std::vector<py::ssize_t> input_shape{static_cast<py::ssize_t>(row_indices.size())};
+    input_shape.insert(input_shape.end(), shard.input_row_shape.begin(), shard.input_row_shape.end());
+    std::vector<py::ssize_t> target_shape{static_cast<py::ssize_t>(row_indices.size())};
+    target_shape.insert(target_shape.end(), shard.target_row_shape.begin(), shard.target_row_shape.end());
+
+    size_t input_row = shard.rows > 0 ? shard.inputs.size() / shard.rows : 0;
+    size_t target_row_bytes = shard.rows > 0 ? shard.targets.size() / shard.rows : 0;
+    py::array_t<float> inputs(input_shape);
+    py::array targets = shard.integer_targets ? py::array(py::array_t<int64_t>(target_shape))
+                                              : py::array(py::array_t<float>(target_shape));
+    float* input_out = inputs.mutable_data();
+    char* target_out = static_cast<char*>(targets.mutable_data());
+    for (size_t i = 0; i < row_indices.size(); ++i) {
+        size_t row = row_indices[i];
+        if (row >= shard.rows) {
+            throw std::out_of_range("Row " + std::to_string(row) + " of data shard " + shard_id);
+        }
+        std::memcpy(input_out + i * input_row, shard.inputs.data() + row * input_row, input_row * sizeof(float));
+        std::memcpy(target_out + i * target_row_bytes, shard.targets.data() + row * target_row_bytes, target_row_bytes);
+    }
+    py::object torch = py::module_::import("torch");
+    return {torch.attr("from_numpy")(inputs), torch.attr("from_numpy")(targets)};
+}
+
+void DataShardStore::remove(const std::string& shard_id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    shards.erase(shard_id);
+}
+
+// The module's trainable parameters; throws unless they are contiguous float32 on the CPU, which
+// the flat gradient and optimizer buffers assume
+static std::vector<py::object> trainable_parameters(py::object module) {
+    py::object torch = py::module_::import("torch");
+    std::vector<py::object> parameters;
+    for (auto parameter : module.attr("parameters")()) {
+        if (!parameter.attr("requires_grad").cast<bool>()) {
+            continue;
+        }
+        if (!parameter.attr("dtype").equal(torch.attr("float32")) ||
+            parameter.attr("device").attr("type").cast<std::string>() != "cpu" ||
+            !parameter.attr("is_contiguous")().cast<bool>()) {
+            throw std::runtime_error("Server-side training needs contiguous float32 parameters on the CPU");
+        }
+        parameters.push_back(py::reinterpret_borrow<py::object>(parameter));
+    }
+    return parameters;
+}
+
+LocalStepsResult run_local_steps(py::object module, py::object criterion, LocalOptimizerState& state,
+                                 const DataShardStore& data, const std::string& shard_id,
+                                 uint32_t steps, uint32_t batch_size, uint64_t seed) {
+    std::vector<py::object> parameters = trainable_parameters(module);
+    bool rebuild = state.optimizers.size() != parameters.size();
+    for (size_t i = 0; i < parameters.size() && !rebuild; ++i) {
+        rebuild = state.optimizers[i].size() != parameters[i].attr("numel")().cast<size_t>();
+    }
+    if (rebuild) {
+        state.optimizers.clear();
+        for (const auto& parameter : parameters) {
+            state.optimizers.emplace_back(state.options, parameter.attr("numel")().cast<size_t>());
+        }
+    }
+
+    size_t rows = data.rows(shard_id);
+    if (rows == 0) {
+        throw std::runtime_error("Data shard " + shard_id + " is empty");
+    }
+    size_t batch = batch_size == 0 ? rows : std::min<size_t>(batch_size, rows);
+    std::vector<size_t> order(rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::mt19937_64 rng(seed);
+    std::shuffle(order.begin(), order.end(), rng);
+    size_t cursor = 0;
+
+    LocalStepsResult result;
+    bool was_training = module.attr("training").cast<bool>();
+    module.attr("train")();
+    try {
+        for (uint32_t step = 0; step < steps; ++step) {
+            if (cursor + batch > rows) {
+                std::shuffle(order.begin(), order.end(), rng);
+                cursor = 0;
+            }
+            std::vector<size_t> indices(order.begin() + cursor, order.begin() + cursor + batch);
+            cursor += batch;
+            auto [inputs, targets] = data.batch(shard_id, indices);
+
+            module.attr("zero_grad")();
+            py::object loss = criterion(module(inputs), targets);
+            loss.attr("backward")();
+            result.loss_sum += loss.attr("item")().cast<double>();
+
+            // Parameter storage and gradients as raw buffers; the views keep them alive while the
+            // updates run without the GIL
+            struct Update {
+                size_t index;
+                float* parameter;
+                const float* grad;
+                size_t count;
+            };
+            std::vector<py::array_t<float>> views;
+            std::vector<Update> updates;
+            for (size_t i = 0; i < parameters.size(); ++i) {
+                py::object grad = parameters[i].attr("grad");
+                if (grad.is_none()) {
+                    continue;
+                }
+                py::array_t<float> parameter_view = parameters[i].attr("detach")().attr("numpy")();
+                py::array_t<float> grad_view = grad.attr("detach")().attr("contiguous")().attr("numpy")();
+                updates.push_back({i, parameter_view.mutable_data(), grad_view.data(),
+                                   static_cast<size_t>(grad_view.size())});
+                views.push_back(std::move(parameter_view));
+                views.push_back(std::move(grad_view));
+            }
+            {
+                py::gil_scoped_release release;
+                for (const auto& update : updates) {
+                    state.optimizers[update.index].step(update.parameter, update.grad, update.count);
+                }
+            }
+            result.steps++;
+            result.samples += batch;
+        }
+    } catch (...) {
+        if (!was_training) {
+            module.attr("eval")();
+        }
+        throw;
+    }
+    if (!was_training) {
+        module.attr("eval")();
+    }
+    return result;
+}
+
+LocalStepsResult compute_batch_gradients(py::object module, py::object criterion, const DataShardStore& data,
+                                         const std::string& shard_id, uint32_t batch_size, uint64_t seed,
+                                         std::string* gradients) {
+    std::vector<py::object> parameters = trainable_parameters(module);
+    size_t rows = data.rows(shard_id);
+    if (rows == 0) {
+        throw std::runtime_error("Data shard " + shard_id + " is empty");
+    }
+    // Rows are drawn with replacement, which keeps a step O(batch) however large the shard is
+    std::vector<size_t> indices;
+    if (batch_size == 0 || batch_size >= rows) {
+        indices.resize(rows);
+        std::iota(indices.begin(), indices.end(), 0);
+    } else {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<size_t> row(0, rows - 1);
+        for (uint32_t i = 0; i < batch_size; ++i) {
+            indices.push_back(row(rng));
+        }
+    }
+    auto [inputs, targets] = data.batch(shard_id, indices);
+
+    LocalStepsResult result;
+    bool was_training = module.attr("training").cast<bool>();
+    module.attr("train")();
+    try {
+        module.attr("zero_grad")();
+        py::object loss = criterion(module(inputs), targets);
+        loss.attr("backward")();
+        result.loss_sum = loss.attr("item")().cast<double>();
+        result.steps = 1;
+        result.samples = indices.size();
+
+        size_t total = 0;
+        for (const auto& parameter : parameters) {
+            total += parameter.attr("numel")().cast<size_t>();
+        }
+        gradients->assign(total * sizeof(float), '\0');
+        char* out = &(*gradients)[0];
+        for (const auto& parameter : parameters) {
+            size_t bytes = parameter.attr("numel")().cast<size_t>() * sizeof(float);
+            py::object grad = parameter.attr("grad");
+            if (!grad.is_none()) {
+                py::array_t<float> values = grad.attr("detach")().attr("contiguous")().attr("numpy")();
+                std::memcpy(out, values.data(), bytes);
+            }
+            out += bytes;
+        }
+        module.attr("zero_grad")();
+    } catch (...) {
+        if (!was_training) {
+            module.attr("eval")();
+        }
+        throw;
+    }
+    if (!was_training) {
+        module.attr("eval")();
+    }
+    return result;
+}
@@ -0,0 +1,77 @@
+#ifndef LOCAL_TRAINING_H
+#define LOCAL_TRAINING_H
+
+#include <pybind11/pybind11.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "flat_optimizer.h"
+
+namespace py = pybind11;
+
+// Training samples a server keeps for local SGD: input rows (float32) and one target row per
+// input row, either int64 class indices or float32 values
+struct DataShard {
+    std::vector<int64_t> input_row_shape;   // Shape of one input row (without the batch dimension)
+    std::vector<int64_t> target_row_shape;  // Shape of one target row; empty for a scalar per row
+    bool integer_targets = false;
+    size_t rows = 0;
+    std::vector<float> inputs;
+    std::string targets;                    // Raw int64 or float32 target bytes
+};
+
+// The data shards stored on a server, keyed by shard id. Rows can be uploaded in several parts;
+// batches are copied out under the lock, so an upload never races a training step.
+class DataShardStore {
+private:
+    mutable std::mutex mutex;
+    std::map<std::string, DataShard> shards;
+
+public:
+    // Replace the shard (or add rows to it if append) with rows of inputs and targets.
+    // Throws std::invalid_argument if the rows do not match the shapes or an existing shard.
+    size_t store(const std::string& shard_id, bool append, const std::vector<int64_t>& input_shape,
+                 const std::string& inputs, const std::vector<int64_t>& target_shape,
+                 const std::string& targets, bool integer_targets);
+
+    // Rows in the shard; throws std::runtime_error if it does not exist
+    size_t rows(const std::string& shard_id) const;
+
+    // Copy the given rows into a batch of input and target tensors; caller holds the GIL
+    std::pair<py::object, py::object> batch(const std::string& shard_id, const std::vector<size_t>& row_indices) const;
+
+    void remove(const std::string& shard_id);
+};
+
+// Per-parameter optimizer state a server keeps for a model between local SGD rounds
+struct LocalOptimizerState {
+    OptimizerOptions options;
+    std::vector<FlatOptimizer> optimizers;  // One per trainable parameter, in module.parameters() order
+};
+
+struct LocalStepsResult {
+    double loss_sum = 0.0;
+    size_t steps = 0;
+    size_t samples = 0;
+};
+
+// Run steps optimizer steps of module on batches of batch_size rows drawn from the shard without
+// replacement (reshuffled with seed each pass). Gradients come from autograd; the updates are
+// applied with FlatOptimizer directly on the parameters' storage, so no Python optimizer runs.
+// state is rebuilt when empty or when the parameters changed shape. Caller holds the GIL.
+LocalStepsResult run_local_steps(py::object module, py::object criterion, LocalOptimizerState& state,
+                                 const DataShardStore& data, const std::string& shard_id,
+                                 uint32_t steps, uint32_t batch_size, uint64_t seed);
+
+// Gradients of criterion on one batch of batch_size rows drawn with seed, flattened into gradients
+// as float32 in module.parameters() order (zeros for trainable parameters without a gradient).
+// Leaves the module's .grad fields cleared. Caller holds the GIL.
+LocalStepsResult compute_batch_gradients(py::object module, py::object criterion, const DataShardStore& data,
+                                         const std::string& shard_id, uint32_t batch_size, uint64_t seed,
+                                         std::string* gradients);
+
+#endif // LOCAL_TRAINING_H
@@ -0,0 +1,201 @@
+#include "logging.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+std::atomic<int> log_threshold{-1};
+
+int init_log_threshold() {
+    LogLevel level = LogLevel::Info;
+    const char* env = std::getenv("LEAF_LOG_LEVEL");
+    if (env && *env) {
+        try {
+            level = parse_log_level(env);
+        } catch (const std::invalid_argument& e) {
+            std::cerr << e.what() << "; logging at info" << std::endl;
+        }
+    }
+    int expected = -1;
+    // set_log_level() may have won the race; its level stands
+    log_threshold.compare_exchange_strong(expected, static_cast<int>(level), std::memory_order_relaxed);
+    return log_threshold.load(std::memory_order_relaxed);
+}
+
+void set_log_level(LogLevel level) {
+    log_threshold.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+LogLevel get_log_level() {
+    int threshold = log_threshold.load(std::memory_order_relaxed);
+    return static_cast<LogLevel>(threshold < 0 ? init_log_threshold() : threshold);
+}
+
+LogLevel parse_log_level(const std::string& name) {
+    static const LogLevel levels[] = {LogLevel::Trace, LogLevel::Debug, LogLevel::Info,
+                                      LogLevel::Warn, LogLevel::Error, LogLevel::Off};
+    for (LogLevel level : levels) {
+        if (name == log_level_name(level)) {
+            return level;
+        }
+    }
+    if (name == "warning") {
+        return LogLevel::Warn;
+    }
+    throw std::invalid_argument("Unknown log level '" + name + "' (expected trace, debug, info, warn, error or off)");
+}
+
+const char* log_level_name(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return "trace";
+        case LogLevel::Debug: return "debug";
+        case LogLevel::Info: return "info";
+        case LogLevel::Warn: return "warn";
+        case LogLevel::Error: return "error";
+        default: return "off";
+    }
+}
+
+namespace {
+
+struct LogEntry {
+    LogLevel level = LogLevel::Info;
+    std::chrono::system_clock::time_point time;
+    std::string message;
+};
+
+// "[W 12:34:56.789] message"
+void append_line(std::string& out, LogLevel level, std::chrono::system_clock::time_point time, const std::string& message) {
+    static const char tags[] = "TDIWE";
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    int millis = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        time.time_since_epoch()).count() % 1000);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    char prefix[32];
+    std::snprintf(prefix, sizeof(prefix), "[%c %02d:%02d:%02d.%03d] ", tags[static_cast<int>(level)],
+                  local.tm_hour, local.tm_min, local.tm_sec, millis);
+    out += prefix;
+    out += message;
+    out += '\n';
+}
+
+// Bounded ring of pending messages. Callers only format and enqueue; one writer thread drains
+// the ring in batches and writes each batch to stdout with a single write and flush.
+class LogSink {
+private:
+    static constexpr size_t capacity = 8192;
+
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::condition_variable written_cv;
+    std::vector<LogEntry> ring;
+    size_t head = 0;
+    size_t count = 0;
+    uint64_t dropped = 0;
+    uint64_t queued = 0;   // Messages ever enqueued
+    uint64_t written = 0;  // Messages ever written
+
+    void run() {
+        std::vector<LogEntry> batch;
+        std::string out;
+        while (true) {
+            uint64_t lost;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                not_empty.wait(lock, [this] { return count > 0 || dropped > 0; });
+                batch.clear();
+                while (count > 0) {
+                    batch.push_back(std::move(ring[head]));
+                    head = (head + 1) % capacity;
+                    --count;
+                }
+                lost = dropped;
+                dropped = 0;
+            }
+            not_full.notify_all();
+
+            out.clear();
+            if (lost > 0) {
+                append_line(out, LogLevel::Warn, std::chrono::system_clock::now(),
+                            std::to_string(lost) + " log messages dropped; the log buffer was full");
+            }
+            for (const auto& entry : batch) {
+                append_line(out, entry.level, entry.time, entry.message);
+            }
+            std::fwrite(out.data(), 1, out.size(), stdout);
+            std::fflush(stdout);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                written += batch.size();
+            }
+            written_cv.notify_all();
+        }
+    }
+
+public:
+    LogSink() : ring(capacity) {
+        // The sink is never destroyed, so the writer runs until the process exits
+        std::thread(&LogSink::run, this).detach();
+    }
+
+    void push(LogLevel level, std::string message) {
+        auto now = std::chrono::system_clock::now();
+        std::unique_lock<std::mutex> lock(mutex);
+        if (count == capacity) {
+            if (level < LogLevel::Warn) {
+                ++dropped;
+                return;
+            }
+            not_full.wait(lock, [this] { return count < capacity; });
+        }
+        LogEntry& entry = ring[(head + count) % capacity];
+        entry.level = level;
+        entry.time = now;
+        entry.message = std::move(message);
+        ++count;
+        ++queued;
+        if (count == 1) {
+            not_empty.notify_one();
+        }
+    }
+
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t target = queued;
+        written_cv.wait(lock, [this, target] { return written >= target; });
+    }
+};
+
+std::atomic<LogSink*> sink_instance{nullptr};
+
+LogSink& log_sink() {
+    static LogSink* sink = [] {
+        auto* created = new LogSink();
+        sink_instance.store(created, std::memory_order_release);
+        std::atexit(log_flush);
+        return created;
+    }();
+    return *sink;
+}
+
+}  // namespace
+
+void log_write(LogLevel level, std::string message) {
+    log_sink().push(level, std::move(message));
+}
+
+void log_flush() {
+    LogSink* sink = sink_instance.load(std::memory_order_acquire);
+    if (sink) {
+        sink->flush();
+    }
+}
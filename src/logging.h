@@ -0,0 +1,60 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+
+#include <atomic>
+#include <sstream>
+#include <string>
+
+enum class LogLevel { Trace = 0, Debug = 1, Info = 2, Warn = 3, Error = 4, Off = 5 };
+
+// Statements below this level are compiled out entirely, e.g. -DLEAF_LOG_COMPILE_LEVEL=2 keeps
+// Info and above. Everything is compiled in by default and filtered at runtime.
+#ifndef LEAF_LOG_COMPILE_LEVEL
+#define LEAF_LOG_COMPILE_LEVEL 0
+#endif
+
+// Runtime threshold; -1 until first read from LEAF_LOG_LEVEL (default "info")
+extern std::atomic<int> log_threshold;
+int init_log_threshold();
+
+inline bool log_enabled(LogLevel level) {
+    int threshold = log_threshold.load(std::memory_order_relaxed);
+    if (threshold < 0) {
+        threshold = init_log_threshold();
+    }
+    return static_cast<int>(level) >= threshold;
+}
+
+void set_log_level(LogLevel level);
+LogLevel get_log_level();
+// Accepts trace, debug, info, warn, error or off; throws std::invalid_argument otherwise
+LogLevel parse_log_level(const std::string& name);
+const char* log_level_name(LogLevel level);
+
+// Queue a formatted message for the background writer. Never blocks on I/O: when the ring
+// buffer is full, messages below Warn are dropped (and counted) and Warn/Error wait for space.
+void log_write(LogLevel level, std::string message);
+
+// Block until every queued message has been written; registered with atexit
+void log_flush();
+
+// The message is a stream expression, e.g. LEAF_LOG_DEBUG("Chunk " << i << " sent"); its operands
+// are only evaluated when the level is enabled, so disabled statements cost one relaxed load
+#define LEAF_LOG(level, message)                                                   \
+    do {                                                                           \
+        if constexpr (static_cast<int>(level) >= LEAF_LOG_COMPILE_LEVEL) {         \
+            if (log_enabled(level)) {                                              \
+                std::ostringstream leaf_log_stream;                                \
+                leaf_log_stream << message;                                        \
+                log_write(level, leaf_log_stream.str());                           \
+            }                                                                      \
+        }                                                                          \
+    } while (0)
+
+#define LEAF_LOG_TRACE(message) LEAF_LOG(LogLevel::Trace, message)
+#define LEAF_LOG_DEBUG(message) LEAF_LOG(LogLevel::Debug, message)
+#define LEAF_LOG_INFO(message) LEAF_LOG(LogLevel::Info, message)
+#define LEAF_LOG_WARN(message) LEAF_LOG(LogLevel::Warn, message)
+#define LEAF_LOG_ERROR(message) LEAF_LOG(LogLevel::Error, message)
+
+#endif // LOGGING_H
@@ -0,0 +1,114 @@
+#include "mapped_file.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile() : mapping(nullptr), length(0) {}
+
+MappedFile::MappedFile(const std::string& file_path) : mapping(nullptr), length(0) {
+    open(file_path);
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : path(std::move(other.path)), mapping(other.mapping), length(other.length) {
+    other.mapping = nullptr;
+    other.length = 0;
+    other.path.clear();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        path = std::move(other.path);
+        mapping = other.mapping;
+        length = other.length;
+        other.mapping = nullptr;
+        other.length = 0;
+        other.path.clear();
+    }
+    return *this;
+}
+
+void MappedFile::open(const std::string& file_path) {
+    close();
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open " + file_path + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::runtime_error("Failed to stat " + file_path + ": " + std::strerror(err));
+    }
+    size_t file_size = static_cast<size_t>(st.st_size);
+    void* ptr = nullptr;
+    if (file_size > 0) {
+        ptr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            int err = errno;
+            ::close(fd);
+            throw std::runtime_error("Failed to mmap " + file_path + ": " + std::strerror(err));
+        }
+    }
+    // The mapping keeps the file contents reachable; the descriptor is no longer needed
+    ::close(fd);
+    path = file_path;
+    mapping = ptr;
+    length = file_size;
+}
+
+void MappedFile::close() {
+    if (mapping != nullptr) {
+        munmap(mapping, length);
+    }
+    mapping = nullptr;
+    length = 0;
+    path.clear();
+}
+
+void MappedFile::write_file(const std::string& file_path, const void* data, size_t size, bool sync) {
+    std::string tmp_path = file_path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to create " + tmp_path + ": " + std::strerror(errno));
+    }
+
+    const size_t max_write = 8 * 1024 * 1024;  // 8MB sequential writes
+    const char* bytes = static_cast<const char*>(data);
+    size_t written = 0;
+    while (written < size) {
+        ssize_t n = ::write(fd, bytes + written, std::min(max_write, size - written));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            int err = errno;
+            ::close(fd);
+            ::unlink(tmp_path.c_str());
+            throw std::runtime_error("Failed to write " + tmp_path + ": " + std::strerror(err));
+        }
+        written += static_cast<size_t>(n);
+    }
+    if (sync && fsync(fd) != 0) {
+        int err = errno;
+        ::close(fd);
+        ::unlink(tmp_path.c_str());
+        throw std::runtime_error("Failed to fsync " + tmp_path + ": " + std::strerror(err));
+    }
+    ::close(fd);
+    if (std::rename(tmp_path.c_str(), file_path.c_str()) != 0) {
+        int err = errno;
+        ::unlink(tmp_path.c_str());
+        throw std::runtime_error("Failed to rename " + tmp_path + " to " + file_path + ": " + std::strerror(err));
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a whole file. Pages are faulted in lazily by the kernel as they are
+// touched, so mapping a large weight file is cheap until the data is actually read.
+class MappedFile {
+private:
+    std::string path;
+    void* mapping;
+    size_t length;
+
+public:
+    MappedFile();
+    explicit MappedFile(const std::string& file_path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Map the file, replacing any previous mapping; throws std::runtime_error on failure
+    void open(const std::string& file_path);
+    void close();
+
+    bool is_open() const { return !path.empty(); }
+    const void* data() const { return mapping; }
+    size_t size() const { return length; }
+    const std::string& get_path() const { return path; }
+
+    // Write a buffer to a file in large sequential writes, replacing it atomically via a temporary
+    // file and rename. Throws std::runtime_error on failure.
+    static void write_file(const std::string& file_path, const void* data, size_t size, bool sync = false);
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,155 @@
+#include "metrics.h"
+#include <algorithm>
+
+size_t metrics_shard_index() {
+    static std::atomic<size_t> next_thread{0};
+    thread_local const size_t index = next_thread.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+uint64_t Counter::value() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t Histogram::bucket_of(uint64_t value) {
+    const uint64_t sub_buckets = 1ULL << sub_bucket_bits;
+    if (value < sub_buckets) {
+        return static_cast<size_t>(value);
+    }
+    unsigned exponent = 63 - static_cast<unsigned>(__builtin_clzll(value));
+    if (exponent > max_exponent) {
+        return bucket_count - 1;
+    }
+    unsigned shift = exponent - sub_bucket_bits;
+    size_t sub_bucket = static_cast<size_t>((value >> shift) & (sub_buckets - 1));
+    return ((exponent - sub_bucket_bits + 1) << sub_bucket_bits) + sub_bucket;
+}
+
+uint64_t Histogram::bucket_upper_bound(size_t bucket) {
+    const uint64_t sub_buckets = 1ULL << sub_bucket_bits;
+    if (bucket < sub_buckets) {
+        return bucket;
+    }
+    unsigned shift = static_cast<unsigned>(bucket >> sub_bucket_bits) - 1;
+    uint64_t lower = (sub_buckets + (bucket & (sub_buckets - 1))) << shift;
+    return lower + (1ULL << shift) - 1;
+}
+
+void Histogram::record(uint64_t value) {
+    Shard& shard = shards[metrics_shard_index() % shard_count];
+    shard.buckets[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+    uint64_t current = shard.max.load(std::memory_order_relaxed);
+    while (value > current && !shard.max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSummary Histogram::summarize() const {
+    HistogramSummary summary;
+    std::array<uint64_t, bucket_count> merged{};
+    for (const auto& shard : shards) {
+        summary.count += shard.count.load(std::memory_order_relaxed);
+        summary.sum += shard.sum.load(std::memory_order_relaxed);
+        summary.max = std::max(summary.max, shard.max.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < bucket_count; ++i) {
+            merged[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    // Shards are read one after another while others record, so the bucket total can differ
+    // slightly from count; percentiles are taken over the buckets
+    uint64_t total = 0;
+    for (uint64_t n : merged) {
+        total += n;
+    }
+    if (total == 0) {
+        return summary;
+    }
+    summary.mean = static_cast<double>(summary.sum) / static_cast<double>(summary.count);
+    const std::pair<double, uint64_t*> quantiles[] = {
+        {0.5, &summary.p50}, {0.9, &summary.p90}, {0.99, &summary.p99}, {0.999, &summary.p999},
+    };
+    for (const auto& [quantile, target] : quantiles) {
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * static_cast<double>(total) + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            seen += merged[i];
+            if (seen >= rank) {
+                *target = std::min(bucket_upper_bound(i), summary.max);
+                break;
+            }
+        }
+    }
+    return summary;
+}
+
+MetricsRegistry::MetricsRegistry() : created(std::chrono::steady_clock::now()) {}
+
+Counter& MetricsRegistry::counter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& slot = counters[name];
+    if (!slot) {
+        slot = std::make_unique<Counter>();
+    }
+    return *slot;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& slot = histograms[name];
+    if (!slot) {
+        slot = std::make_unique<Histogram>();
+    }
+    return *slot;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot snapshot;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& [name, counter] : counters) {
+        snapshot.counters[name] = counter->value();
+    }
+    for (const auto& [name, histogram] : histograms) {
+        snapshot.histograms[name] = histogram->summarize();
+    }
+    snapshot.uptime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - created).count();
+    return snapshot;
+}
+
+MetricsRegistry& metrics() {
+    // Never destroyed, so threads still recording during static destruction stay safe
+    static MetricsRegistry* registry = new MetricsRegistry();
+    return *registry;
+}
+
+RpcMetrics::RpcMetrics(const std::string& method)
+    : latency_us(metrics().histogram("rpc." + method + ".latency_us")),
+      bytes_in(metrics().counter("rpc." + method + ".bytes_in")),
+      bytes_out(metrics().counter("rpc." + method + ".bytes_out")),
+      failures(metrics().counter("rpc." + method + ".failures")) {}
+
+void metrics_to_proto(const MetricsSnapshot& snapshot, leaftest::MetricsResponse* response) {
+    for (const auto& [name, value] : snapshot.counters) {
+        auto* counter = response->add_counters();
+        counter->set_name(name);
+        counter->set_value(value);
+    }
+    for (const auto& [name, summary] : snapshot.histograms) {
+        auto* histogram = response->add_histograms();
+        histogram->set_name(name);
+        histogram->set_count(summary.count);
+        histogram->set_sum(summary.sum);
+        histogram->set_max(summary.max);
+        histogram->set_mean(summary.mean);
+        histogram->set_p50(summary.p50);
+        histogram->set_p90(summary.p90);
+        histogram->set_p99(summary.p99);
+        histogram->set_p999(summary.p999);
+    }
+    response->set_uptime_ms(snapshot.uptime_ms);
+}
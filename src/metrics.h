@@ -0,0 +1,156 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "server_communication.pb.h"
+
+// Updates go to one of several cache-line-aligned shards picked per thread, so threads recording
+// the same metric do not contend on one atomic; reads sum the shards
+size_t metrics_shard_index();
+
+// Monotonic counter; add() is a relaxed atomic increment on the calling thread's shard
+class Counter {
+public:
+    static constexpr size_t shard_count = 16;
+
+    void add(uint64_t amount = 1) {
+        shards[metrics_shard_index() % shard_count].value.fetch_add(amount, std::memory_order_relaxed);
+    }
+    uint64_t value() const;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+    std::array<Shard, shard_count> shards;
+};
+
+struct HistogramSummary {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    double mean = 0.0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+};
+
+// HDR-style histogram of non-negative integers (latencies in microseconds, sizes in bytes).
+// Values below 16 are counted exactly; above that, each power of two is split into 16 linear
+// sub-buckets, so any reported percentile is within 1/16 (6.25%) of the true value. Values up
+// to 2^40 are distinguished. record() is lock-free.
+class Histogram {
+public:
+    static constexpr size_t shard_count = 8;
+    static constexpr unsigned sub_bucket_bits = 4;
+    static constexpr unsigned max_exponent = 40;
+    static constexpr size_t bucket_count = (max_exponent - sub_bucket_bits + 2) << sub_bucket_bits;
+
+    void record(uint64_t value);
+    HistogramSummary summarize() const;
+
+    static size_t bucket_of(uint64_t value);
+    // Largest value that falls into the bucket
+    static uint64_t bucket_upper_bound(size_t bucket);
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> max{0};
+        std::array<std::atomic<uint64_t>, bucket_count> buckets{};
+    };
+    std::array<Shard, shard_count> shards;
+};
+
+struct MetricsSnapshot {
+    std::map<std::string, uint64_t> counters;
+    std::map<std::string, HistogramSummary> histograms;
+    int64_t uptime_ms = 0;
+};
+
+// Named counters and histograms. Lookups take a lock, so hot paths look a metric up once (e.g.
+// into a function-local static) and keep the reference, which stays valid for the registry's life.
+class MetricsRegistry {
+private:
+    mutable std::mutex mutex;
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    std::chrono::steady_clock::time_point created;
+
+public:
+    MetricsRegistry();
+
+    Counter& counter(const std::string& name);
+    Histogram& histogram(const std::string& name);
+    MetricsSnapshot snapshot() const;
+};
+
+// Process-wide registry
+MetricsRegistry& metrics();
+
+inline uint64_t microseconds_since(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+// Records the microseconds between construction and destruction into a histogram
+class ScopedTimer {
+private:
+    Histogram& histogram;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedTimer(Histogram& target) : histogram(target), start(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() { histogram.record(microseconds_since(start)); }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+// The metrics kept for each RPC method, named "rpc.<method>.latency_us", ".bytes_in", ".bytes_out"
+// and ".failures"; bytes are counted from this process's point of view
+struct RpcMetrics {
+    Histogram& latency_us;
+    Counter& bytes_in;
+    Counter& bytes_out;
+    Counter& failures;
+
+    explicit RpcMetrics(const std::string& method);
+};
+
+// Times a server handler and counts its message sizes, and a failure if the response does not
+// report success, when it returns
+template <typename Request, typename Response>
+class RpcScope {
+private:
+    RpcMetrics& rpc;
+    const Request& request;
+    const Response& response;
+    ScopedTimer timer;
+
+public:
+    RpcScope(RpcMetrics& rpc_metrics, const Request& rpc_request, const Response& rpc_response)
+        : rpc(rpc_metrics), request(rpc_request), response(rpc_response), timer(rpc_metrics.latency_us) {}
+    ~RpcScope() {
+        rpc.bytes_in.add(request.ByteSizeLong());
+        rpc.bytes_out.add(response.ByteSizeLong());
+        if (!response.success()) {
+            rpc.failures.add();
+        }
+    }
+    RpcScope(const RpcScope&) = delete;
+    RpcScope& operator=(const RpcScope&) = delete;
+};
+
+void metrics_to_proto(const MetricsSnapshot& snapshot, leaftest::MetricsResponse* response);
+
+#endif // METRICS_H
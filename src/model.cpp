@@ -1,24 +1,45 @@
 #include "model.h"
-#include <iostream>
+#include "logging.h"
+#include <algorithm>
 #include <cstring>
+#include <cstdint>
+#include <stdexcept>
 
 namespace py = pybind11;
 
+size_t tensor_nbytes(const py::object& tensor) {
+    if (py::hasattr(tensor, "element_size") && py::hasattr(tensor, "numel")) {
+        return tensor.attr("element_size")().cast<size_t>() * tensor.attr("numel")().cast<size_t>();
+    }
+    return 0;
+}
+
+std::shared_ptr<const py::object> share_py_object(py::object object) {
+    return std::shared_ptr<const py::object>(new py::object(std::move(object)), [](const py::object* owned) {
+        py::gil_scoped_acquire gil;
+        delete owned;
+    });
+}
+
 Model::Model(py::object model, LeafTrainer* trainer)
-    : pytorch_model(model), leaf_trainer(trainer), computed_outputs(false) {}
+    : pytorch_model(model), leaf_trainer(trainer), computed_outputs(false),
+      stored_output_bytes(0), max_stored_output_bytes(256 * 1024 * 1024) {}
 
 bool Model::forward(py::object input) {
     try {
         // Call the original model's forward method
         py::object output = pytorch_model.attr("forward")(input);
         
-        // Store the output
-        stored_outputs.push_back(output);
+        // Store the output, dropping the oldest ones once the byte budget is exceeded
+        size_t nbytes = tensor_nbytes(output);
+        stored_outputs.emplace_back(output, nbytes);
+        stored_output_bytes += nbytes;
+        evict_stored_outputs();
         computed_outputs = true;
         
         return true;
     } catch (const std::exception& e) {
-        std::cout << "Error in Model::forward: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error in Model::forward: " << e.what());
         return false;
     }
 }
@@ -27,6 +48,10 @@ bool Model::operator()(py::object input) {
     return forward(input);
 }
 
+bool Model::has_module() const {
+    return pytorch_model.ptr() != Py_None;
+}
+
 py::object Model::get_pytorch_model() const {
     return pytorch_model;
 }
@@ -39,15 +64,54 @@ bool Model::has_computed_outputs() const {
     return computed_outputs;
 }
 
-const std::vector<py::object>& Model::get_stored_outputs() const {
-    return stored_outputs;
+std::vector<py::object> Model::get_stored_outputs() const {
+    std::vector<py::object> outputs;
+    outputs.reserve(stored_outputs.size());
+    for (const auto& entry : stored_outputs) {
+        outputs.push_back(entry.first);
+    }
+    return outputs;
+}
+
+py::object Model::take_stored_output() {
+    if (stored_outputs.empty()) {
+        return py::none();
+    }
+    py::object output = stored_outputs.front().first;
+    stored_output_bytes -= stored_outputs.front().second;
+    stored_outputs.pop_front();
+    if (stored_outputs.empty()) {
+        computed_outputs = false;
+    }
+    return output;
 }
 
 void Model::clear_stored_outputs() {
     stored_outputs.clear();
+    stored_output_bytes = 0;
     computed_outputs = false;
 }
 
+void Model::evict_stored_outputs() {
+    while (stored_output_bytes > max_stored_output_bytes && stored_outputs.size() > 1) {
+        stored_output_bytes -= stored_outputs.front().second;
+        stored_outputs.pop_front();
+    }
+}
+
+void Model::set_max_stored_output_bytes(size_t max_bytes) {
+    max_stored_output_bytes = max_bytes;
+    evict_stored_outputs();
+}
+
+size_t Model::get_max_stored_output_bytes() const {
+    return max_stored_output_bytes;
+}
+
+size_t Model::get_stored_output_bytes() const {
+    return stored_output_bytes;
+}
+
 py::object Model::state_dict() {
     return pytorch_model.attr("state_dict")();
 }
@@ -97,6 +161,7 @@ std::vector<float> Model::serialize_state() const {
     
     try {
         // Extract model state from PyTorch model
+        py::object torch = py::module_::import("torch");
         py::object state_dict = pytorch_model.attr("state_dict")();
         
         // Convert state dict to flat vector
@@ -108,7 +173,9 @@ std::vector<float> Model::serialize_state() const {
             
             // Check if tensor has cpu() method
             if (py::hasattr(tensor, "cpu")) {
-                py::object cpu_tensor = tensor.attr("cpu")();
+                // Convert in torch, which also handles dtypes numpy lacks (bfloat16)
+                py::object cpu_tensor = tensor.attr("detach")().attr("to")(py::arg("device") = "cpu",
+                                                                          py::arg("dtype") = torch.attr("float32"));
                 if (py::hasattr(cpu_tensor, "flatten")) {
                     // Flatten the tensor to 1D first, then convert to numpy
                     py::object flattened_tensor = cpu_tensor.attr("flatten")();
@@ -119,17 +186,17 @@ std::vector<float> Model::serialize_state() const {
                             model_state.push_back(buffer[i]);
                         }
                     } else {
-                        std::cout << "Warning: Flattened tensor does not have numpy() method" << std::endl;
+                        LEAF_LOG_WARN("Flattened tensor does not have numpy() method");
                     }
                 } else {
-                    std::cout << "Warning: CPU tensor does not have flatten() method" << std::endl;
+                    LEAF_LOG_WARN("CPU tensor does not have flatten() method");
                 }
             } else {
-                std::cout << "Warning: Tensor does not have cpu() method" << std::endl;
+                LEAF_LOG_WARN("Tensor does not have cpu() method");
             }
         }
     } catch (const std::exception& e) {
-        std::cout << "Error during state dict serialization: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error during state dict serialization: " << e.what());
         throw;
     }
     
@@ -137,48 +204,174 @@ std::vector<float> Model::serialize_state() const {
 }
 
 void Model::deserialize_state(const std::vector<float>& state) {
+    deserialize_state_from(state.data(), state.size());
+}
+
+size_t Model::state_nbytes() const {
+    if (pytorch_model.is_none()) {
+        return 0;
+    }
+    size_t nbytes = 0;
+    py::object state_dict = pytorch_model.attr("state_dict")();
+    for (auto item : state_dict.attr("items")()) {
+        nbytes += tensor_nbytes(item.attr("__getitem__")(1));
+    }
+    return nbytes;
+}
+
+size_t Model::state_numel() const {
+    if (pytorch_model.is_none()) {
+        return 0;
+    }
+    size_t numel = 0;
+    py::object state_dict = pytorch_model.attr("state_dict")();
+    for (auto item : state_dict.attr("items")()) {
+        numel += item.attr("__getitem__")(1).attr("numel")().cast<size_t>();
+    }
+    return numel;
+}
+
+std::vector<std::pair<const float*, size_t>> Model::capture_state(py::list& owners, bool copy) const {
+    std::vector<std::pair<const float*, size_t>> chunks;
+    if (pytorch_model.is_none()) {
+        return chunks;
+    }
+    py::object torch = py::module_::import("torch");
+    py::object float32 = torch.attr("float32");
+    py::object state_dict = pytorch_model.attr("state_dict")();
+    for (auto item : state_dict.attr("items")()) {
+        py::object tensor = item.attr("__getitem__")(1).attr("detach")();
+        bool usable = tensor.attr("device").attr("type").cast<std::string>() == "cpu" &&
+                      tensor.attr("dtype").is(float32) && tensor.attr("is_contiguous")().cast<bool>();
+        if (!usable) {
+            tensor = tensor.attr("to")(py::arg("device") = "cpu", py::arg("dtype") = float32).attr("contiguous")();
+        } else if (copy) {
+            tensor = tensor.attr("clone")();
+        }
+        auto data = reinterpret_cast<const float*>(tensor.attr("data_ptr")().cast<uintptr_t>());
+        chunks.emplace_back(data, tensor.attr("numel")().cast<size_t>());
+        owners.append(tensor);
+    }
+    return chunks;
+}
+
+// Names of the module's buffers that state_dict() leaves out
+static std::vector<std::string> non_persistent_buffer_names(const py::object& module) {
+    std::vector<std::string> names;
+    py::object state_dict = module.attr("state_dict")();
+    for (auto item : module.attr("named_buffers")()) {
+        py::object name = item.attr("__getitem__")(0);
+        if (!state_dict.contains(name)) {
+            names.push_back(name.cast<std::string>());
+        }
+    }
+    return names;
+}
+
+std::string Model::serialize_architecture() const {
+    if (pytorch_model.is_none()) {
+        return "";
+    }
+    py::object torch = py::module_::import("torch");
+    py::object builtins = py::module_::import("builtins");
+    
+    // Seed the deepcopy memo with meta stand-ins for every tensor, so the copy duplicates the
+    // module structure without ever copying its weights
+    py::dict memo;
+    for (auto param : pytorch_model.attr("parameters")()) {
+        py::object meta = param.attr("detach")().attr("to")(py::str("meta"));
+        memo[builtins.attr("id")(param)] = torch.attr("nn").attr("Parameter")(meta, py::arg("requires_grad") = param.attr("requires_grad"));
+    }
+    // Non-persistent buffers are not in serialize_state, so they keep their data
+    std::vector<std::string> non_persistent = non_persistent_buffer_names(pytorch_model);
+    for (auto item : pytorch_model.attr("named_buffers")()) {
+        std::string name = item.attr("__getitem__")(0).cast<std::string>();
+        if (std::find(non_persistent.begin(), non_persistent.end(), name) != non_persistent.end()) {
+            continue;
+        }
+        py::object buffer = item.attr("__getitem__")(1);
+        memo[builtins.attr("id")(buffer)] = buffer.attr("detach")().attr("to")(py::str("meta"));
+    }
+    py::object skeleton = py::module_::import("copy").attr("deepcopy")(pytorch_model, memo);
+    
+    py::object buffer = py::module_::import("io").attr("BytesIO")();
+    torch.attr("save")(skeleton, buffer);
+    return buffer.attr("getvalue")().cast<std::string>();
+}
+
+void Model::deserialize_state_from(const float* state, size_t count) {
     try {
-        // Extract model state from PyTorch model
+        py::object torch = py::module_::import("torch");
         py::object state_dict = pytorch_model.attr("state_dict")();
-        
-        // Convert state dict to flat vector
-        py::object items = state_dict.attr("items")();
         size_t state_index = 0;
         
-        for (auto item : items) {
-            // Extract the tensor value from the key-value pair
-            py::object tensor = item.attr("__getitem__")(1);  // Get the value (tensor) from the key-value pair
-            
-            // Check if tensor has cpu() method
-            if (py::hasattr(tensor, "cpu")) {
-                py::object cpu_tensor = tensor.attr("cpu")();
-                if (py::hasattr(cpu_tensor, "flatten")) {
-                    // Flatten the tensor to 1D first, then convert to numpy
-                    py::object flattened_tensor = cpu_tensor.attr("flatten")();
-                    if (py::hasattr(flattened_tensor, "numpy")) {
-                        py::array_t<float> numpy_array = flattened_tensor.attr("numpy")();
-                        auto buffer = numpy_array.mutable_unchecked<1>();
-                        
-                        // Copy state data back to tensor
-                        for (py::ssize_t i = 0; i < buffer.size() && state_index < state.size(); ++i) {
-                            buffer(i) = state[state_index++];
-                        }
-                        
-                        // Update the original tensor with the new values
-                        // This is a simplified approach - in practice, you might need to handle this differently
-                        // depending on how PyTorch tensors are managed
-                    } else {
-                        std::cout << "Warning: Flattened tensor does not have numpy() method" << std::endl;
-                    }
-                } else {
-                    std::cout << "Warning: CPU tensor does not have flatten() method" << std::endl;
-                }
-            } else {
-                std::cout << "Warning: Tensor does not have cpu() method" << std::endl;
+        for (auto item : state_dict.attr("items")()) {
+            // state_dict() tensors are detached and share the module's storage
+            py::object tensor = item.attr("__getitem__")(1);
+            size_t numel = tensor.attr("numel")().cast<size_t>();
+            if (state_index + numel > count) {
+                throw std::runtime_error("State has " + std::to_string(count) + " values, fewer than the model's " +
+                                         std::to_string(state_index + numel) + " or more");
             }
+            
+            // A float32 view of this tensor's slice of the state (no copy); copy_ writes it into the
+            // tensor itself, whatever its dtype, device or strides
+            py::array_t<float> source({static_cast<py::ssize_t>(numel)}, {static_cast<py::ssize_t>(sizeof(float))},
+                                      const_cast<float*>(state + state_index), py::none());
+            tensor.attr("copy_")(torch.attr("from_numpy")(source).attr("view")(tensor.attr("shape")));
+            state_index += numel;
         }
     } catch (const std::exception& e) {
-        std::cout << "Error during state dict deserialization: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error during state dict deserialization: " << e.what());
         throw;
     }
-} 
\ No newline at end of file
+}
+
+bool Model::state_fits_float32() const {
+    if (pytorch_model.is_none()) {
+        return true;
+    }
+    py::object torch = py::module_::import("torch");
+    py::object state_dict = pytorch_model.attr("state_dict")();
+    for (auto item : state_dict.attr("items")()) {
+        py::object tensor = item.attr("__getitem__")(1);
+        py::object dtype = tensor.attr("dtype");
+        if (dtype.is(torch.attr("float32")) || dtype.is(torch.attr("float16")) || dtype.is(torch.attr("bfloat16")) ||
+            dtype.is(torch.attr("bool")) || dtype.is(torch.attr("uint8")) || dtype.is(torch.attr("int8")) ||
+            dtype.is(torch.attr("int16"))) {
+            continue;
+        }
+        bool small_integers = (dtype.is(torch.attr("int32")) || dtype.is(torch.attr("int64"))) &&
+                              (tensor.attr("numel")().cast<size_t>() == 0 ||
+                               tensor.attr("abs")().attr("max")().attr("item")().cast<int64_t>() <= (int64_t(1) << 24));
+        if (!small_integers) {
+            return false;
+        }
+    }
+    return true;
+}
+
+py::dict Model::copy_non_persistent_buffers() const {
+    py::dict copies;
+    if (pytorch_model.is_none()) {
+        return copies;
+    }
+    for (const auto& name : non_persistent_buffer_names(pytorch_model)) {
+        py::object buffer = pytorch_model.attr("get_buffer")(name);
+        if (!buffer.attr("is_meta").cast<bool>()) {
+            copies[py::str(name)] = buffer.attr("detach")().attr("clone")();
+        }
+    }
+    return copies;
+}
+
+void Model::restore_buffers(const py::dict& buffers) {
+    for (auto item : buffers) {
+        // "block.attn.cache" is buffer "cache" of submodule "block.attn"
+        std::string name = item.first.cast<std::string>();
+        size_t dot = name.rfind('.');
+        py::object owner = dot == std::string::npos ? pytorch_model
+                                                    : pytorch_model.attr("get_submodule")(name.substr(0, dot));
+        py::setattr(owner, py::str(dot == std::string::npos ? name : name.substr(dot + 1)), item.second);
+    }
+}
@@ -6,18 +6,32 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <deque>
+#include <utility>
 
 namespace py = pybind11;
 
 // Forward declaration
 class LeafTrainer;
 
+// Share ownership of a Python object with C++ code that may drop it without holding the GIL
+std::shared_ptr<const py::object> share_py_object(py::object object);
+
+// Size of a tensor's data in bytes, or 0 for objects that are not tensors
+size_t tensor_nbytes(const py::object& tensor);
+
 class Model {
 private:
     py::object pytorch_model;
     LeafTrainer* leaf_trainer;
     bool computed_outputs;
-    std::vector<py::object> stored_outputs;
+    // Ring of recent outputs and their sizes, bounded by max_stored_output_bytes
+    std::deque<std::pair<py::object, size_t>> stored_outputs;
+    size_t stored_output_bytes;
+    size_t max_stored_output_bytes;
+
+    // Drop the oldest outputs while over budget, always keeping the newest one
+    void evict_stored_outputs();
 
 public:
     Model(py::object model, LeafTrainer* trainer);
@@ -31,18 +45,32 @@ public:
     // Get the underlying PyTorch model
     py::object get_pytorch_model() const;
     
+    // Whether a module is held rather than the None placeholder; copies no Python object, so it
+    // may be called without the GIL
+    bool has_module() const;
+    
     // Get the LeafTrainer pointer
     LeafTrainer* get_leaf_trainer() const;
     
     // Get computed outputs status
     bool has_computed_outputs() const;
     
-    // Get stored outputs
-    const std::vector<py::object>& get_stored_outputs() const;
+    // Get stored outputs, oldest first
+    std::vector<py::object> get_stored_outputs() const;
+    
+    // Remove and return the oldest stored output (None if there is none); the loss/backward
+    // phase uses this so each output is released as soon as it has been consumed
+    py::object take_stored_output();
     
     // Clear stored outputs
     void clear_stored_outputs();
     
+    // Byte budget for stored outputs; the oldest outputs are dropped once it is exceeded, but the
+    // newest output is kept even if it alone is larger, so it can still be taken
+    void set_max_stored_output_bytes(size_t max_bytes);
+    size_t get_max_stored_output_bytes() const;
+    size_t get_stored_output_bytes() const;
+    
     // Delegate common PyTorch model methods to the underlying model
     py::object state_dict();
     py::object parameters();
@@ -67,6 +95,38 @@ public:
     
     // Deserialize model state from vector of floats
     void deserialize_state(const std::vector<float>& state);
+    
+    // Deserialize model state from a raw float buffer (e.g. a memory-mapped weight file). Each
+    // state tensor is written in place with copy_, converting to its own dtype. Throws
+    // std::runtime_error if count is smaller than the state.
+    void deserialize_state_from(const float* state, size_t count);
+    
+    // True if serialize_state holds every state tensor exactly: floating tensors of at most 32
+    // bits, and integer tensors whose values float32 represents (|v| <= 2^24). A model whose
+    // storage is reallocated and refilled from the flat state (spilling, checkpoints) needs this.
+    bool state_fits_float32() const;
+    
+    // Copies of the non-persistent buffers (those state_dict leaves out) that hold data, i.e. are
+    // not on the meta device, keyed by name. restore_buffers installs them as the module's buffers
+    // again, e.g. after to_empty() or to("meta") replaced them.
+    py::dict copy_non_persistent_buffers() const;
+    void restore_buffers(const py::dict& buffers);
+    
+    // Bytes held by the tensors in the model's state dict
+    size_t state_nbytes() const;
+    
+    // Number of floats serialize_state produces
+    size_t state_numel() const;
+    
+    // The state dict as float32 CPU buffers in serialize_state order, for a checkpoint. Tensors
+    // that already are contiguous float32 on the CPU are referenced rather than copied unless
+    // copy is set. owners receives the tensors that own the returned buffers.
+    std::vector<std::pair<const float*, size_t>> capture_state(py::list& owners, bool copy = false) const;
+    
+    // torch.save() the module with every state tensor on the meta device: the architecture without
+    // the weights, which serialize_state carries separately. Non-persistent buffers are not in the
+    // state, so they are saved with their data.
+    std::string serialize_architecture() const;
 };
 
 #endif // MODEL_H 
\ No newline at end of file
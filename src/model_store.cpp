@@ -0,0 +1,370 @@
+#include "model_store.h"
+#include "mapped_file.h"
+#include "logging.h"
+#include <Python.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+#include <sys/stat.h>
+
+namespace py = pybind11;
+
+// File name for a model's spilled weights; model ids are client supplied, so keep them flat
+static std::string spill_file_name(const std::string& model_id) {
+    std::string name = model_id;
+    std::replace(name.begin(), name.end(), '/', '_');
+    return name + ".weights";
+}
+
+// Give a module fresh, uninitialized CPU storage for its state, keeping the contents of its
+// non-persistent buffers, which the flat weights do not carry. Caller holds the GIL.
+static void reallocate_state(Model& model) {
+    py::dict buffers = model.copy_non_persistent_buffers();
+    model.get_pytorch_model().attr("to_empty")(py::arg("device") = "cpu");
+    model.restore_buffers(buffers);
+}
+
+ModelStore::ModelStore(const ModelStoreOptions& opts)
+    : options(opts), resident_bytes(0), clock(0), spill_count(0), fault_count(0) {}
+
+ModelStore::~ModelStore() {
+    // Dropping the models releases their Python objects
+    if (Py_IsInitialized()) {
+        py::gil_scoped_acquire gil;
+        for (auto& [model_id, entry] : entries) {
+            if (!entry.spill_path.empty()) {
+                std::remove(entry.spill_path.c_str());
+            }
+        }
+        entries.clear();
+    }
+}
+
+bool ModelStore::contains(const std::string& model_id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.find(model_id) != entries.end();
+}
+
+std::shared_ptr<Model> ModelStore::get(const std::string& model_id) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(model_id);
+        if (it == entries.end()) {
+            return nullptr;
+        }
+        if (!it->second.spilled) {
+            return pin(model_id, it->second);
+        }
+    }
+
+    // Faulting a model back in runs Python, and the GIL must be taken before the mutex
+    py::gil_scoped_acquire gil;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(model_id);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    if (it->second.spilled) {
+        fault_in(model_id, it->second);
+        enforce_budget(model_id);
+    }
+    return pin(model_id, it->second);
+}
+
+void ModelStore::put(const std::string& model_id, std::shared_ptr<Model> model) {
+    py::gil_scoped_acquire gil;
+    size_t nbytes = model ? model->state_nbytes() : 0;
+    std::shared_ptr<Model> previous;  // Released after the mutex, still under the GIL
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry& entry = entries[model_id];
+        if (entry.model && entry.model.get() == model.get()) {
+            // Same module updated in place (e.g. new weights); keep its pins and refresh its size
+            if (!entry.spilled) {
+                resident_bytes -= entry.nbytes;
+            }
+        } else {
+            if (entry.model && !entry.spilled) {
+                resident_bytes -= entry.nbytes;
+            }
+            previous = std::move(entry.model);
+            entry.model = std::move(model);
+            entry.architecture.clear();
+            entry.snapshot_token.reset();
+            entry.pins = 0;
+            entry.unspillable = false;
+        }
+        if (entry.spilled) {
+            discard_spilled_weights(entry);
+        }
+        entry.nbytes = nbytes;
+        entry.last_used = ++clock;
+        resident_bytes += nbytes;
+        enforce_budget(model_id);
+    }
+}
+
+bool ModelStore::has_architecture(const std::string& model_id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(model_id);
+    return it != entries.end() && it->second.model && it->second.model->has_module();
+}
+
+void ModelStore::update_weights(const std::string& model_id, const float* weights, size_t count) {
+    py::gil_scoped_acquire gil;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(model_id);
+    if (it == entries.end() || !it->second.model || !it->second.model->has_module()) {
+        throw std::runtime_error("No architecture stored for model " + model_id);
+    }
+    Entry& entry = it->second;
+    size_t expected = entry.model->state_numel();
+    if (count != expected) {
+        throw std::runtime_error("Expected " + std::to_string(expected) + " weights for model " + model_id +
+                                 ", got " + std::to_string(count));
+    }
+
+    // Every weight is overwritten, so fresh storage needs no initialization: a spilled model is not
+    // read back, and a snapshot still writing the old storage keeps its consistent copy
+    bool shared = entry.snapshot_token && entry.snapshot_token.use_count() > 1;
+    if (entry.spilled || shared) {
+        reallocate_state(*entry.model);
+        entry.snapshot_token.reset();
+    }
+    entry.model->deserialize_state_from(weights, count);
+    if (entry.spilled) {
+        discard_spilled_weights(entry);
+        resident_bytes += entry.nbytes;
+    }
+    entry.last_used = ++clock;
+    enforce_budget(model_id);
+}
+
+void ModelStore::remove(const std::string& model_id) {
+    py::gil_scoped_acquire gil;
+    std::shared_ptr<Model> previous;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(model_id);
+        if (it == entries.end()) {
+            return;
+        }
+        if (it->second.spilled) {
+            if (!it->second.spill_path.empty()) {
+                std::remove(it->second.spill_path.c_str());
+            }
+        } else {
+            resident_bytes -= it->second.nbytes;
+        }
+        previous = std::move(it->second.model);
+        entries.erase(it);
+    }
+}
+
+std::vector<std::string> ModelStore::ids() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> model_ids;
+    for (const auto& pair : entries) {
+        model_ids.push_back(pair.first);
+    }
+    return model_ids;
+}
+
+void ModelStore::put_mapped(const std::string& model_id, std::shared_ptr<Model> model,
+                            std::shared_ptr<const MappedFile> mapping, const float* weights, size_t count) {
+    py::gil_scoped_acquire gil;
+    // Size of the weights once faulted in; the meta module reports it without allocating
+    size_t nbytes = model->state_nbytes();
+    std::shared_ptr<Model> previous;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry& entry = entries[model_id];
+        if (entry.model && !entry.spilled) {
+            resident_bytes -= entry.nbytes;
+        }
+        if (!entry.spill_path.empty()) {
+            std::remove(entry.spill_path.c_str());
+        }
+        previous = std::move(entry.model);
+        entry = Entry();
+        entry.model = std::move(model);
+        entry.nbytes = nbytes;
+        entry.spilled = true;
+        entry.backing = std::move(mapping);
+        entry.backing_weights = weights;
+        entry.backing_count = count;
+        entry.last_used = ++clock;
+    }
+}
+
+std::vector<ModelSnapshot> ModelStore::snapshot() {
+    py::gil_scoped_acquire gil;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<ModelSnapshot> snapshots;
+    for (auto& [model_id, entry] : entries) {
+        if (!entry.model || entry.model->get_pytorch_model().is_none()) {
+            continue;  // Placeholders have nothing to restore
+        }
+        if (!entry.spilled && !entry.model->state_fits_float32()) {
+            // Restoring it from float32 weights would change its state
+            LEAF_LOG_WARN("ModelStore: Not checkpointing model " << model_id
+                          << ", whose state float32 cannot hold exactly");
+            continue;
+        }
+        if (entry.architecture.empty()) {
+            entry.architecture = entry.model->serialize_architecture();
+        }
+
+        ModelSnapshot snapshot;
+        snapshot.tensor.model_id = model_id;
+        snapshot.tensor.architecture = entry.architecture;
+        if (!entry.spilled) {
+            py::list owners;
+            snapshot.tensor.chunks = entry.model->capture_state(owners);
+            snapshot.keepalive.push_back(share_py_object(owners));
+            if (!entry.snapshot_token) {
+                entry.snapshot_token = std::make_shared<const int>(0);
+            }
+            snapshot.keepalive.push_back(entry.snapshot_token);
+        } else if (entry.backing) {
+            snapshot.tensor.chunks.emplace_back(entry.backing_weights, entry.backing_count);
+            snapshot.keepalive.push_back(entry.backing);
+        } else {
+            auto weights = std::make_shared<MappedFile>(entry.spill_path);
+            snapshot.tensor.chunks.emplace_back(static_cast<const float*>(weights->data()), weights->size() / sizeof(float));
+            snapshot.keepalive.push_back(weights);
+        }
+        for (const auto& chunk : snapshot.tensor.chunks) {
+            snapshot.tensor.count += chunk.second;
+        }
+        snapshots.push_back(std::move(snapshot));
+    }
+    return snapshots;
+}
+
+size_t ModelStore::get_resident_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return resident_bytes;
+}
+
+size_t ModelStore::get_spilled_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = 0;
+    for (const auto& pair : entries) {
+        if (pair.second.spilled) {
+            count++;
+        }
+    }
+    return count;
+}
+
+size_t ModelStore::get_spill_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return spill_count;
+}
+
+size_t ModelStore::get_fault_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return fault_count;
+}
+
+std::shared_ptr<Model> ModelStore::pin(const std::string& model_id, Entry& entry) {
+    entry.pins++;
+    entry.last_used = ++clock;
+    std::shared_ptr<Model> keep = entry.model;
+    Model* raw = keep.get();
+    // The returned pointer shares ownership of the model and unpins it when the last copy goes away
+    return std::shared_ptr<Model>(raw, [this, model_id, keep, raw](Model*) mutable {
+        {
+            // The store may have dropped the model meanwhile, making this the last reference
+            py::gil_scoped_acquire gil;
+            keep.reset();
+        }
+        unpin(model_id, raw);
+    });
+}
+
+void ModelStore::unpin(const std::string& model_id, const Model* model) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(model_id);
+    // A replaced model's pins do not carry over to its successor
+    if (it != entries.end() && it->second.model.get() == model && it->second.pins > 0) {
+        it->second.pins--;
+    }
+}
+
+void ModelStore::enforce_budget(const std::string& keep_id) {
+    if (options.memory_budget_bytes == 0 || resident_bytes <= options.memory_budget_bytes) {
+        return;
+    }
+
+    // Coldest first
+    std::vector<std::pair<uint64_t, std::string>> candidates;
+    for (const auto& [model_id, entry] : entries) {
+        if (model_id != keep_id && !entry.spilled && !entry.unspillable && entry.pins == 0 && entry.nbytes > 0) {
+            candidates.emplace_back(entry.last_used, model_id);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates) {
+        if (resident_bytes <= options.memory_budget_bytes) {
+            break;
+        }
+        try {
+            spill(candidate.second, entries[candidate.second]);
+        } catch (const std::exception& e) {
+            LEAF_LOG_WARN("ModelStore: Failed to spill model " << candidate.second << ": " << e.what());
+        }
+    }
+}
+
+void ModelStore::spill(const std::string& model_id, Entry& entry) {
+    if (!entry.model->state_fits_float32()) {
+        entry.unspillable = true;
+        throw std::runtime_error("its state is not exactly representable as float32 weights; keeping it resident");
+    }
+    if (mkdir(options.spill_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+        throw std::runtime_error("Failed to create spill directory " + options.spill_dir);
+    }
+    std::string path = options.spill_dir + "/" + spill_file_name(model_id);
+    std::vector<float> state = entry.model->serialize_state();
+    MappedFile::write_file(path, state.data(), state.size() * sizeof(float));
+
+    // Moving the module to the meta device frees its storage but keeps the architecture; the
+    // non-persistent buffers the weight file lacks stay on the CPU
+    py::dict buffers = entry.model->copy_non_persistent_buffers();
+    entry.model->get_pytorch_model().attr("to")(py::str("meta"));
+    entry.model->restore_buffers(buffers);
+    entry.spilled = true;
+    entry.spill_path = path;
+    resident_bytes -= entry.nbytes;
+    spill_count++;
+    LEAF_LOG_INFO("ModelStore: Spilled model " << model_id << " (" << entry.nbytes << " bytes) to " << path);
+}
+
+void ModelStore::fault_in(const std::string& model_id, Entry& entry) {
+    reallocate_state(*entry.model);
+    if (entry.backing) {
+        entry.model->deserialize_state_from(entry.backing_weights, entry.backing_count);
+    } else {
+        MappedFile weights(entry.spill_path);
+        entry.model->deserialize_state_from(static_cast<const float*>(weights.data()), weights.size() / sizeof(float));
+    }
+    discard_spilled_weights(entry);
+    resident_bytes += entry.nbytes;
+    fault_count++;
+    LEAF_LOG_INFO("ModelStore: Faulted model " << model_id << " back in (" << entry.nbytes << " bytes)");
+}
+
+void ModelStore::discard_spilled_weights(Entry& entry) {
+    if (!entry.spill_path.empty()) {
+        std::remove(entry.spill_path.c_str());
+    }
+    entry.spilled = false;
+    entry.spill_path.clear();
+    entry.backing.reset();
+    entry.backing_weights = nullptr;
+    entry.backing_count = 0;
+}
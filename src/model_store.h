@@ -0,0 +1,123 @@
+#ifndef MODEL_STORE_H
+#define MODEL_STORE_H
+
+#include <pybind11/pybind11.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "model.h"
+#include "checkpoint.h"
+#include "mapped_file.h"
+
+namespace py = pybind11;
+
+struct ModelStoreOptions {
+    size_t memory_budget_bytes = 0;            // Resident weight bytes allowed; 0 means unlimited
+    std::string spill_dir = "/tmp/leaf-spill";  // Where cold models' weights are written
+};
+
+// A model's architecture and weights captured for a checkpoint; keepalive owns the weight data
+struct ModelSnapshot {
+    CheckpointTensor tensor;
+    std::vector<std::shared_ptr<const void>> keepalive;
+};
+
+// Server-side store of models with a memory budget.
+//
+// Every stored model is accounted by the bytes of its state dict. When the resident total exceeds
+// the budget, the least recently used models are spilled: their flat weights are written to a
+// file under spill_dir and the module is moved to the meta device, which frees its storage but
+// keeps the architecture. The next get() faults a spilled model back in by memory-mapping its
+// weight file and loading the weights into a freshly allocated module. Models restored from a
+// checkpoint start out the same way, spilled with their weights in the mapped checkpoint.
+// The flat weights are float32, so only models whose state float32 holds exactly are spilled or
+// checkpointed (Model::state_fits_float32); non-persistent buffers are kept aside in memory.
+//
+// Models returned by get() are pinned until the last copy of the returned pointer is released, so
+// a model is never spilled while a forward pass is using it.
+//
+// Snapshots reference resident weights instead of copying them. update_weights() is copy-on-write:
+// while a snapshot still holds a model's storage, the new weights go into freshly allocated
+// storage and the snapshot keeps the old, unmodified tensors.
+//
+// Locking: Python work happens under the GIL, and the GIL is always taken before the store mutex.
+class ModelStore {
+private:
+    struct Entry {
+        std::shared_ptr<Model> model;
+        size_t nbytes = 0;
+        bool spilled = false;
+        std::string spill_path;
+        std::shared_ptr<const MappedFile> backing;  // Mapped weights of a spilled model not in spill_path
+        const float* backing_weights = nullptr;
+        size_t backing_count = 0;
+        std::string architecture;                   // Cached serialize_architecture() output
+        std::shared_ptr<const int> snapshot_token;  // Held by every snapshot of the current storage
+        int pins = 0;
+        uint64_t last_used = 0;
+        bool unspillable = false;                   // State float32 cannot hold exactly; stays resident
+    };
+
+    ModelStoreOptions options;
+    mutable std::mutex mutex;
+    std::map<std::string, Entry> entries;
+    size_t resident_bytes;
+    uint64_t clock;
+    size_t spill_count;
+    size_t fault_count;
+
+    // Caller holds the GIL and the mutex
+    void spill(const std::string& model_id, Entry& entry);
+    void fault_in(const std::string& model_id, Entry& entry);
+    void enforce_budget(const std::string& keep_id);
+    void discard_spilled_weights(Entry& entry);
+
+    // Caller holds the mutex
+    std::shared_ptr<Model> pin(const std::string& model_id, Entry& entry);
+    void unpin(const std::string& model_id, const Model* model);
+
+public:
+    explicit ModelStore(const ModelStoreOptions& opts = ModelStoreOptions());
+    ~ModelStore();
+
+    ModelStore(const ModelStore&) = delete;
+    ModelStore& operator=(const ModelStore&) = delete;
+
+    bool contains(const std::string& model_id) const;
+
+    // Returns the model, faulting it back in if it was spilled; nullptr if it is not stored
+    std::shared_ptr<Model> get(const std::string& model_id);
+
+    // Store or replace a model and spill colder models if the budget is exceeded
+    void put(const std::string& model_id, std::shared_ptr<Model> model);
+
+    // True if the model is stored with an architecture, i.e. it is not a placeholder. Needs no GIL.
+    bool has_architecture(const std::string& model_id) const;
+
+    // Overwrite all of a stored model's weights with a flat state in serialize_state order.
+    // Throws std::runtime_error if the model has no architecture or the size does not match.
+    void update_weights(const std::string& model_id, const float* weights, size_t count);
+    void remove(const std::string& model_id);
+    std::vector<std::string> ids() const;
+
+    // Store a model whose module is on the meta device and whose weights live in a mapping, e.g. a
+    // checkpoint; the weights are loaded on first use
+    void put_mapped(const std::string& model_id, std::shared_ptr<Model> model,
+                    std::shared_ptr<const MappedFile> mapping, const float* weights, size_t count);
+
+    // Capture every stored model for a checkpoint. Resident weights are referenced copy-on-write;
+    // spilled weights are shared with their mapping.
+    std::vector<ModelSnapshot> snapshot();
+
+    size_t get_resident_bytes() const;
+    size_t get_spilled_count() const;
+    size_t get_spill_count() const;
+    size_t get_fault_count() const;
+    const ModelStoreOptions& get_options() const { return options; }
+};
+
+#endif // MODEL_STORE_H
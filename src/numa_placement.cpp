@@ -0,0 +1,122 @@
+#include "numa_placement.h"
+#include "resource_probe.h"
+#include "logging.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+// From linux/mempolicy.h; called through syscall() so the server does not need libnuma
+static const int mpol_preferred = 1;
+static const int mpol_preferred_many = 5;  // Linux 5.15+
+
+static void set_preferred_nodes(const std::vector<int>& nodes) {
+    const size_t bits_per_word = 8 * sizeof(unsigned long);
+    unsigned long mask[1024 / (8 * sizeof(unsigned long))] = {};
+    for (int node : nodes) {
+        mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+    }
+    // The kernel reads maxnode - 1 bits of the mask
+    unsigned long maxnode = sizeof(mask) * 8 + 1;
+    // Preferred rather than bound: under memory pressure pages spill to other nodes instead of
+    // the server being OOM-killed
+    if (nodes.size() > 1 && syscall(SYS_set_mempolicy, mpol_preferred_many, mask, maxnode) == 0) {
+        return;
+    }
+    if (nodes.size() > 1) {
+        // Older kernels can only prefer a single node
+        LEAF_LOG_WARN("Preferring memory from NUMA node " << nodes.front()
+                      << " only; this kernel cannot prefer several nodes");
+        std::fill(std::begin(mask), std::end(mask), 0UL);
+        mask[nodes.front() / bits_per_word] = 1UL << (nodes.front() % bits_per_word);
+    }
+    if (syscall(SYS_set_mempolicy, mpol_preferred, mask, maxnode) != 0) {
+        throw std::runtime_error(std::string("set_mempolicy failed: ") + std::strerror(errno));
+    }
+}
+#endif
+
+Placement apply_placement(const PlacementOptions& options) {
+    HostResources host = probe_host_resources();
+    Placement placement;
+    placement.numa_nodes = options.numa_nodes;
+    placement.cpus = options.cpus;
+
+    std::set<int> known_cpus;
+    for (const auto& node : host.numa_nodes) {
+        known_cpus.insert(node.cpus.begin(), node.cpus.end());
+    }
+    for (int node_id : placement.numa_nodes) {
+        auto node = std::find_if(host.numa_nodes.begin(), host.numa_nodes.end(),
+                                 [node_id](const NumaNodeInfo& n) { return n.id == node_id; });
+        if (node == host.numa_nodes.end()) {
+            throw std::runtime_error("NUMA node " + std::to_string(node_id) + " does not exist");
+        }
+        // Without an explicit CPU list, run on every CPU of the nodes
+        if (options.cpus.empty()) {
+            placement.cpus.insert(placement.cpus.end(), node->cpus.begin(), node->cpus.end());
+        }
+    }
+    for (int cpu : placement.cpus) {
+        if (!known_cpus.count(cpu)) {
+            throw std::runtime_error("CPU " + std::to_string(cpu) + " does not exist");
+        }
+        // Without explicit nodes, allocate from the nodes the CPUs belong to
+        if (options.numa_nodes.empty()) {
+            for (const auto& node : host.numa_nodes) {
+                if (std::find(node.cpus.begin(), node.cpus.end(), cpu) != node.cpus.end() &&
+                    std::find(placement.numa_nodes.begin(), placement.numa_nodes.end(), node.id) == placement.numa_nodes.end()) {
+                    placement.numa_nodes.push_back(node.id);
+                }
+            }
+        }
+    }
+    std::sort(placement.cpus.begin(), placement.cpus.end());
+    placement.cpus.erase(std::unique(placement.cpus.begin(), placement.cpus.end()), placement.cpus.end());
+    std::sort(placement.numa_nodes.begin(), placement.numa_nodes.end());
+
+    placement.intra_op_threads = options.intra_op_threads;
+    if (placement.intra_op_threads <= 0) {
+        // Hyperthreads share a core's vector units, so one thread per physical core is faster
+        // for the dense kernels the server runs
+        size_t cpus = placement.cpus.empty() ? host.usable_cpus : placement.cpus.size();
+        placement.intra_op_threads = static_cast<int>(std::max<size_t>(1, cpus / std::max(1u, host.threads_per_core)));
+    }
+
+    if (placement.cpus.empty()) {
+        return placement;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : placement.cpus) {
+        CPU_SET(cpu, &set);
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        throw std::runtime_error(std::string("sched_setaffinity failed: ") + std::strerror(errno));
+    }
+    set_preferred_nodes(placement.numa_nodes);
+#else
+    LEAF_LOG_WARN("CPU and NUMA placement is only supported on Linux; ignoring it");
+#endif
+    return placement;
+}
+
+std::string describe_placement(const Placement& placement) {
+    auto join = [](const std::vector<int>& values) {
+        std::string text;
+        for (int value : values) {
+            text += (text.empty() ? "" : ",") + std::to_string(value);
+        }
+        return text.empty() ? std::string("all") : text;
+    };
+    return "NUMA nodes " + join(placement.numa_nodes) + ", CPUs " + join(placement.cpus) + ", " +
+           std::to_string(placement.intra_op_threads) + " intra-op threads";
+}
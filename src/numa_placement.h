@@ -0,0 +1,31 @@
+#ifndef NUMA_PLACEMENT_H
+#define NUMA_PLACEMENT_H
+
+#include <string>
+#include <vector>
+
+struct PlacementOptions {
+    std::vector<int> numa_nodes;  // Nodes to run and allocate on; empty derives them from cpus
+    std::vector<int> cpus;        // CPUs to run on; empty uses every CPU of numa_nodes
+    int intra_op_threads = 0;     // PyTorch intra-op threads; 0 uses one per physical core placed on
+
+    bool empty() const { return numa_nodes.empty() && cpus.empty(); }
+};
+
+struct Placement {
+    std::vector<int> numa_nodes;
+    std::vector<int> cpus;
+    int intra_op_threads = 0;
+};
+
+// Bind the calling process to the configured CPUs and prefer memory from their NUMA nodes.
+//
+// Call this before any threads are started: gRPC's polling threads, the OpenMP pool behind
+// PyTorch's intra-op parallelism and the allocator all inherit the affinity and memory policy,
+// so receive buffers, weights and activations land on the node whose cores compute on them.
+// Throws std::runtime_error if the options name CPUs or nodes that do not exist.
+Placement apply_placement(const PlacementOptions& options);
+
+std::string describe_placement(const Placement& placement);
+
+#endif // NUMA_PLACEMENT_H
@@ -0,0 +1,108 @@
+#include "output_cache.h"
+
+std::string chunk_request_id(const std::string& request_id, size_t chunk) {
+    return chunk == 0 ? request_id : request_id + "#" + std::to_string(chunk);
+}
+
+OutputCache::OutputCache(size_t budget_bytes)
+    : byte_budget(budget_bytes), bytes_used(0), evictions(0) {}
+
+void OutputCache::put(const std::string& request_id, CachedOutput output) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(request_id);
+    if (it != index.end()) {
+        bytes_used -= it->second->second.data.size();
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    if (output.data.size() > byte_budget) {
+        evictions++;
+        return;
+    }
+    bytes_used += output.data.size();
+    entries.emplace_front(request_id, std::move(output));
+    index[request_id] = entries.begin();
+    evict_over_budget();
+}
+
+bool OutputCache::take(const std::string& request_id, CachedOutput* output) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(request_id);
+    if (it == index.end()) {
+        return false;
+    }
+    bytes_used -= it->second->second.data.size();
+    if (output) {
+        *output = std::move(it->second->second);
+    }
+    entries.erase(it->second);
+    index.erase(it);
+    return true;
+}
+
+size_t OutputCache::take_request(const std::string& request_id, std::vector<CachedOutput>* outputs) {
+    size_t taken = 0;
+    CachedOutput output;
+    while (take(chunk_request_id(request_id, taken), outputs ? &output : nullptr)) {
+        if (outputs) {
+            outputs->push_back(std::move(output));
+        }
+        taken++;
+    }
+    return taken;
+}
+
+bool OutputCache::contains(const std::string& request_id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.find(request_id) != index.end();
+}
+
+void OutputCache::remove_model(const std::string& model_id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.model_id == model_id) {
+            bytes_used -= it->second.data.size();
+            index.erase(it->first);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void OutputCache::set_byte_budget(size_t budget_bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    byte_budget = budget_bytes;
+    evict_over_budget();
+}
+
+size_t OutputCache::get_byte_budget() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return byte_budget;
+}
+
+size_t OutputCache::get_bytes_used() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return bytes_used;
+}
+
+size_t OutputCache::get_entry_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+size_t OutputCache::get_eviction_count() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return evictions;
+}
+
+// Caller holds the mutex
+void OutputCache::evict_over_budget() {
+    while (bytes_used > byte_budget && !entries.empty()) {
+        const Entry& oldest = entries.back();
+        bytes_used -= oldest.second.data.size();
+        index.erase(oldest.first);
+        entries.pop_back();
+        evictions++;
+    }
+}
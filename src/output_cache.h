@@ -0,0 +1,68 @@
+#ifndef OUTPUT_CACHE_H
+#define OUTPUT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A forward output kept on the server until the loss/backward phase asks for it
+struct CachedOutput {
+    std::string model_id;
+    std::string data;             // Raw float32 output bytes (C-contiguous)
+    std::vector<int64_t> shape;   // Batch dimension first
+};
+
+// Key of one chunk of a forward request that the client split along its batch dimension: the
+// request id itself for the first chunk, "<request id>#<chunk>" for the others
+std::string chunk_request_id(const std::string& request_id, size_t chunk);
+
+// LRU cache of forward outputs keyed by request id, bounded by a byte budget.
+//
+// Entries are removed when they are taken (the loss/backward phase reads each output once), and
+// the least recently stored entries are evicted whenever the budget is exceeded, so memory stays
+// flat no matter how many forward passes a long run issues.
+class OutputCache {
+private:
+    using Entry = std::pair<std::string, CachedOutput>;
+
+    size_t byte_budget;
+    size_t bytes_used;
+    size_t evictions;
+    std::list<Entry> entries;  // Most recently stored at the front
+    std::map<std::string, std::list<Entry>::iterator> index;
+    mutable std::mutex mutex;
+
+    void evict_over_budget();
+
+public:
+    explicit OutputCache(size_t budget_bytes = 256 * 1024 * 1024);
+
+    // Store an output; replaces an existing entry with the same request id. Outputs larger than
+    // the whole budget are not cached.
+    void put(const std::string& request_id, CachedOutput output);
+
+    // Remove and return the output for a request id; returns false if it was never stored or evicted
+    bool take(const std::string& request_id, CachedOutput* output);
+
+    // Remove and return the outputs of every chunk of a request, in chunk order, stopping at the
+    // first chunk that was never stored or was evicted; returns how many were taken
+    size_t take_request(const std::string& request_id, std::vector<CachedOutput>* outputs);
+
+    bool contains(const std::string& request_id) const;
+
+    // Drop every output produced by a model (e.g. when the model is replaced)
+    void remove_model(const std::string& model_id);
+
+    void set_byte_budget(size_t budget_bytes);
+    size_t get_byte_budget() const;
+    size_t get_bytes_used() const;
+    size_t get_entry_count() const;
+    size_t get_eviction_count() const;
+};
+
+#endif // OUTPUT_CACHE_H
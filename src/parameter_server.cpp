@@ -0,0 +1,80 @@
+#include "parameter_server.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+ParameterShard::ParameterShard(size_t shard_offset, size_t model_count, const float* initial, size_t count,
+                               const ShardOptions& shard_options)
+    : offset(shard_offset), total_count(model_count), workers(std::max(1u, shard_options.workers)),
+      parameters(initial, initial + count), optimizer(shard_options.optimizer, count) {
+    if (offset + count > total_count) {
+        throw std::invalid_argument("Shard [" + std::to_string(offset) + ", " + std::to_string(offset + count) +
+                                    ") exceeds the model's " + std::to_string(total_count) + " parameters");
+    }
+    if (workers > 1) {
+        pending.assign(count, 0.0f);
+    }
+}
+
+uint64_t ParameterShard::push(const float* gradients, size_t count, bool* applied) {
+    if (count != parameters.size()) {
+        throw std::invalid_argument("Expected " + std::to_string(parameters.size()) + " gradients for shard at " +
+                                    std::to_string(offset) + ", got " + std::to_string(count));
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    *applied = false;
+    if (workers == 1) {
+        optimizer.step(parameters.data(), gradients, count);
+        *applied = true;
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            pending[i] += gradients[i];
+        }
+        if (++pending_pushes == workers) {
+            optimizer.step(parameters.data(), pending.data(), count, 1.0f / static_cast<float>(workers));
+            std::fill(pending.begin(), pending.end(), 0.0f);
+            pending_pushes = 0;
+            *applied = true;
+        }
+    }
+    if (*applied) {
+        ++version;
+        updated.notify_all();
+    }
+    return version;
+}
+
+bool ParameterShard::pull(uint64_t min_version, std::chrono::milliseconds wait, std::string* out,
+                          uint64_t* pulled_version) const {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!updated.wait_for(lock, wait, [&] { return version >= min_version; })) {
+        return false;
+    }
+    out->assign(reinterpret_cast<const char*>(parameters.data()), parameters.size() * sizeof(float));
+    *pulled_version = version;
+    return true;
+}
+
+uint64_t ParameterShard::get_version() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return version;
+}
+
+void ParameterStore::init(const std::string& model_id, std::shared_ptr<ParameterShard> shard) {
+    std::lock_guard<std::mutex> lock(mutex);
+    shards[model_id] = std::move(shard);
+}
+
+std::shared_ptr<ParameterShard> ParameterStore::get(const std::string& model_id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = shards.find(model_id);
+    if (it == shards.end()) {
+        throw std::runtime_error("No parameter shard for model " + model_id);
+    }
+    return it->second;
+}
+
+size_t ParameterStore::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return shards.size();
+}
@@ -0,0 +1,85 @@
+#ifndef PARAMETER_SERVER_H
+#define PARAMETER_SERVER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "flat_optimizer.h"
+
+// Split a flat parameter vector of total elements into count contiguous shards of nearly equal
+// size (the first total % count shards get one more element); returns {offset, count} per shard
+inline std::vector<std::pair<size_t, size_t>> shard_ranges(size_t total, size_t count) {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    size_t offset = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size_t size = total / count + (i < total % count ? 1 : 0);
+        ranges.emplace_back(offset, size);
+        offset += size;
+    }
+    return ranges;
+}
+
+struct ShardOptions {
+    OptimizerOptions optimizer;
+    uint32_t workers = 1;  // Pushes averaged into one update; 1 applies every push on arrival
+};
+
+// One server's slice [offset, offset + size) of a model's flat parameter vector, updated in place
+// from pushed gradients with SGD, Adam or AdamW.
+//
+// With workers > 1 the shard is synchronous: gradients are summed until every worker has pushed
+// for the current version, then their average is applied once and the version advances. Pullers
+// can wait for a version, so workers step in lockstep without a client in the middle.
+class ParameterShard {
+private:
+    mutable std::mutex mutex;
+    mutable std::condition_variable updated;
+    size_t offset;
+    size_t total_count;
+    uint32_t workers;
+    std::vector<float> parameters;
+    FlatOptimizer optimizer;
+    std::vector<float> pending;    // Sum of the gradients pushed for the next version
+    uint32_t pending_pushes = 0;
+    uint64_t version = 0;
+
+public:
+    ParameterShard(size_t shard_offset, size_t model_count, const float* initial, size_t count,
+                   const ShardOptions& shard_options);
+
+    // Add one worker's gradients for this shard; sets applied if they completed an update.
+    // Returns the version after the push. Throws std::invalid_argument on a size mismatch.
+    uint64_t push(const float* gradients, size_t count, bool* applied);
+
+    // Copy the parameters into out once the version reaches min_version, waiting at most wait.
+    // Returns false, leaving out untouched, if the version is still older after waiting.
+    bool pull(uint64_t min_version, std::chrono::milliseconds wait, std::string* out, uint64_t* pulled_version) const;
+
+    size_t get_offset() const { return offset; }
+    size_t get_total_count() const { return total_count; }
+    size_t size() const { return parameters.size(); }
+    uint64_t get_version() const;
+};
+
+// The shards a parameter server holds, one per model
+class ParameterStore {
+private:
+    mutable std::mutex mutex;
+    std::map<std::string, std::shared_ptr<ParameterShard>> shards;
+
+public:
+    // Create or replace the model's shard
+    void init(const std::string& model_id, std::shared_ptr<ParameterShard> shard);
+    // Throws std::runtime_error if the model has no shard here
+    std::shared_ptr<ParameterShard> get(const std::string& model_id) const;
+    size_t size() const;
+};
+
+#endif // PARAMETER_SERVER_H
@@ -0,0 +1,338 @@
+#include "resource_probe.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <dirent.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#include <mach/mach.h>
+#endif
+
+std::vector<int> parse_cpu_list(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        try {
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            // Malformed entry; skip it rather than fail the whole probe
+        }
+    }
+    return cpus;
+}
+
+// Extensions worth choosing kernels by; /proc/cpuinfo lists dozens of flags beyond these
+static const std::set<std::string> interesting_isa_flags = {
+    // x86
+    "sse4_2", "avx", "avx2", "fma", "f16c", "avx512f", "avx512dq", "avx512bw", "avx512vl",
+    "avx512_vnni", "avx512_bf16", "avx512_fp16", "avx_vnni", "amx_tile", "amx_int8", "amx_bf16",
+    // ARM
+    "asimd", "asimdhp", "asimddp", "sve", "sve2", "bf16", "i8mm", "sme",
+};
+
+unsigned vector_width_bits(const std::vector<std::string>& isa_flags) {
+    std::set<std::string> flags(isa_flags.begin(), isa_flags.end());
+    if (flags.count("avx512f")) {
+        return 512;
+    }
+    if (flags.count("avx2") || flags.count("avx")) {
+        return 256;
+    }
+    if (flags.count("sse4_2") || flags.count("asimd") || flags.count("sve")) {
+        return 128;
+    }
+    return 0;
+}
+
+#ifdef __linux__
+static std::string read_first_line(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+static void probe_cpuinfo(HostResources& host) {
+    std::ifstream in("/proc/cpuinfo");
+    std::string line;
+    std::set<std::string> sockets;
+    std::set<std::pair<std::string, std::string>> cores;
+    std::string physical_id;
+    while (std::getline(in, line)) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, line.find_last_not_of(" \t", colon - 1) + 1);
+        std::string value = colon + 2 <= line.size() ? line.substr(colon + 2) : "";
+        if (host.cpu_model.empty() && (key == "model name" || key == "Model" || key == "Hardware")) {
+            host.cpu_model = value;
+        } else if (key == "physical id") {
+            physical_id = value;
+            sockets.insert(value);
+        } else if (key == "core id") {
+            cores.insert({physical_id, value});
+        } else if (host.isa_flags.empty() && (key == "flags" || key == "Features")) {
+            std::istringstream flags(value);
+            std::string flag;
+            while (flags >> flag) {
+                if (interesting_isa_flags.count(flag)) {
+                    host.isa_flags.push_back(flag);
+                }
+            }
+        }
+    }
+    host.sockets = static_cast<unsigned>(sockets.size());
+    host.physical_cores = static_cast<unsigned>(cores.size());
+}
+
+// Sizes in sysfs look like "48K" or "32M"
+static uint64_t parse_cache_size(const std::string& text) {
+    try {
+        size_t end = 0;
+        uint64_t size = std::stoull(text, &end);
+        char unit = end < text.size() ? text[end] : ' ';
+        if (unit == 'K') {
+            size *= 1024;
+        } else if (unit == 'M') {
+            size *= 1024 * 1024;
+        } else if (unit == 'G') {
+            size *= 1024ULL * 1024 * 1024;
+        }
+        return size;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+static void probe_cpu_topology(HostResources& host) {
+    const std::string cpu0 = "/sys/devices/system/cpu/cpu0";
+    host.threads_per_core = static_cast<unsigned>(parse_cpu_list(read_first_line(cpu0 + "/topology/thread_siblings_list")).size());
+    for (int index = 0;; ++index) {
+        std::string dir = cpu0 + "/cache/index" + std::to_string(index);
+        std::string level = read_first_line(dir + "/level");
+        if (level.empty()) {
+            break;
+        }
+        CacheInfo cache;
+        try {
+            cache.level = static_cast<unsigned>(std::stoul(level));
+        } catch (const std::exception&) {
+            continue;
+        }
+        cache.type = read_first_line(dir + "/type");
+        cache.size = parse_cache_size(read_first_line(dir + "/size"));
+        cache.shared_cpus = static_cast<unsigned>(parse_cpu_list(read_first_line(dir + "/shared_cpu_list")).size());
+        host.caches.push_back(cache);
+    }
+}
+
+static void probe_meminfo(HostResources& host) {
+    std::ifstream in("/proc/meminfo");
+    std::string key;
+    uint64_t kib;
+    std::string unit;
+    while (in >> key >> kib) {
+        std::getline(in, unit);
+        if (key == "MemTotal:") {
+            host.memory_total = kib * 1024;
+        } else if (key == "MemAvailable:") {
+            host.memory_available = kib * 1024;
+        }
+    }
+}
+
+static void probe_numa_nodes(HostResources& host) {
+    const std::string root = "/sys/devices/system/node";
+    DIR* dir = opendir(root.c_str());
+    if (!dir) {
+        return;
+    }
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, 4, "node") != 0 || name.size() == 4 || name.find_first_not_of("0123456789", 4) != std::string::npos) {
+            continue;
+        }
+        NumaNodeInfo node;
+        node.id = std::stoi(name.substr(4));
+        node.cpus = parse_cpu_list(read_first_line(root + "/" + name + "/cpulist"));
+        // Lines look like "Node 0 MemTotal:       131596184 kB"
+        std::ifstream meminfo(root + "/" + name + "/meminfo");
+        std::string line;
+        while (std::getline(meminfo, line)) {
+            std::istringstream fields(line);
+            std::string node_word, node_id, key;
+            uint64_t kib = 0;
+            if (!(fields >> node_word >> node_id >> key >> kib)) {
+                continue;
+            }
+            if (key == "MemTotal:") {
+                node.memory_total = kib * 1024;
+            } else if (key == "MemFree:") {
+                node.memory_free = kib * 1024;
+            }
+        }
+        host.numa_nodes.push_back(std::move(node));
+    }
+    closedir(dir);
+    std::sort(host.numa_nodes.begin(), host.numa_nodes.end(),
+              [](const NumaNodeInfo& a, const NumaNodeInfo& b) { return a.id < b.id; });
+}
+#endif
+
+#ifdef __APPLE__
+static std::string sysctl_string(const char* name) {
+    size_t size = 0;
+    if (sysctlbyname(name, nullptr, &size, nullptr, 0) != 0 || size == 0) {
+        return "";
+    }
+    std::string value(size, '\0');
+    if (sysctlbyname(name, &value[0], &size, nullptr, 0) != 0) {
+        return "";
+    }
+    value.resize(value.find('\0') == std::string::npos ? size : value.find('\0'));
+    return value;
+}
+
+template <typename T>
+static T sysctl_value(const char* name) {
+    T value = 0;
+    size_t size = sizeof(value);
+    if (sysctlbyname(name, &value, &size, nullptr, 0) != 0) {
+        return 0;
+    }
+    return value;
+}
+#endif
+
+HostResources probe_host_resources() {
+    HostResources host;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    host.logical_cpus = online > 0 ? static_cast<unsigned>(online) : 0;
+    host.usable_cpus = host.logical_cpus;
+
+#ifdef __linux__
+    probe_cpuinfo(host);
+    probe_cpu_topology(host);
+    probe_meminfo(host);
+    probe_numa_nodes(host);
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    if (sched_getaffinity(0, sizeof(affinity), &affinity) == 0) {
+        host.usable_cpus = static_cast<unsigned>(CPU_COUNT(&affinity));
+    }
+#elif defined(__APPLE__)
+    host.cpu_model = sysctl_string("machdep.cpu.brand_string");
+    host.physical_cores = sysctl_value<int32_t>("hw.physicalcpu");
+    host.sockets = sysctl_value<int32_t>("hw.packages");
+    host.memory_total = sysctl_value<uint64_t>("hw.memsize");
+    int32_t logical = sysctl_value<int32_t>("hw.logicalcpu");
+    if (host.physical_cores > 0 && logical > 0) {
+        host.threads_per_core = static_cast<unsigned>(logical) / host.physical_cores;
+    }
+    const std::pair<const char*, CacheInfo> caches[] = {
+        {"hw.l1dcachesize", {1, "Data", 0, 0}},
+        {"hw.l1icachesize", {1, "Instruction", 0, 0}},
+        {"hw.l2cachesize", {2, "Unified", 0, 0}},
+        {"hw.l3cachesize", {3, "Unified", 0, 0}},
+    };
+    for (const auto& [name, info] : caches) {
+        CacheInfo cache = info;
+        cache.size = sysctl_value<uint64_t>(name);
+        if (cache.size > 0) {
+            host.caches.push_back(cache);
+        }
+    }
+    // hw.optional.* is only present for features the CPU has; names follow /proc/cpuinfo
+    const std::pair<const char*, const char*> features[] = {
+        {"hw.optional.sse4_2", "sse4_2"}, {"hw.optional.avx1_0", "avx"}, {"hw.optional.avx2_0", "avx2"},
+        {"hw.optional.fma", "fma"}, {"hw.optional.avx512f", "avx512f"}, {"hw.optional.avx512bw", "avx512bw"},
+        {"hw.optional.avx512vl", "avx512vl"}, {"hw.optional.neon", "asimd"}, {"hw.optional.neon_hpfp", "asimdhp"},
+        {"hw.optional.arm.FEAT_DotProd", "asimddp"}, {"hw.optional.arm.FEAT_BF16", "bf16"},
+        {"hw.optional.arm.FEAT_I8MM", "i8mm"}, {"hw.optional.arm.FEAT_SME", "sme"},
+    };
+    for (const auto& [name, flag] : features) {
+        if (sysctl_value<int32_t>(name) != 0) {
+            host.isa_flags.push_back(flag);
+        }
+    }
+    vm_statistics64_data_t vm;
+    mach_msg_type_number_t count = HOST_VM_INFO64_COUNT;
+    if (host_statistics64(mach_host_self(), HOST_VM_INFO64, reinterpret_cast<host_info64_t>(&vm), &count) == KERN_SUCCESS) {
+        host.memory_available = (static_cast<uint64_t>(vm.free_count) + vm.inactive_count) * sysconf(_SC_PAGESIZE);
+    }
+#endif
+
+    // Containers and some ARM kernels hide the topology fields; assume one socket without SMT
+    if (host.physical_cores == 0) {
+        host.physical_cores = host.logical_cpus;
+    }
+    if (host.sockets == 0) {
+        host.sockets = 1;
+    }
+    if (host.threads_per_core == 0) {
+        host.threads_per_core = std::max(1u, host.logical_cpus / std::max(1u, host.physical_cores));
+    }
+    if (host.numa_nodes.empty()) {
+        NumaNodeInfo node;
+        for (unsigned cpu = 0; cpu < host.logical_cpus; ++cpu) {
+            node.cpus.push_back(static_cast<int>(cpu));
+        }
+        node.memory_total = host.memory_total;
+        node.memory_free = host.memory_available;
+        host.numa_nodes.push_back(std::move(node));
+    }
+    if (getloadavg(host.load_average, 3) < 0) {
+        host.load_average[0] = host.load_average[1] = host.load_average[2] = 0.0;
+    }
+    return host;
+}
+
+void host_resources_to_proto(const HostResources& host, leaftest::ResourcesResponse* response) {
+    response->set_cpu_model(host.cpu_model);
+    response->set_logical_cpus(host.logical_cpus);
+    response->set_physical_cores(host.physical_cores);
+    response->set_sockets(host.sockets);
+    response->set_threads_per_core(host.threads_per_core);
+    response->set_usable_cpus(host.usable_cpus);
+    for (const auto& cache : host.caches) {
+        auto* level = response->add_caches();
+        level->set_level(cache.level);
+        level->set_type(cache.type);
+        level->set_size_bytes(cache.size);
+        level->set_shared_cpus(cache.shared_cpus);
+    }
+    for (const auto& flag : host.isa_flags) {
+        response->add_isa_flags(flag);
+    }
+    response->set_memory_total_bytes(host.memory_total);
+    response->set_memory_available_bytes(host.memory_available);
+    for (const auto& node : host.numa_nodes) {
+        auto* numa_node = response->add_numa_nodes();
+        numa_node->set_id(static_cast<uint32_t>(node.id));
+        for (int cpu : node.cpus) {
+            numa_node->add_cpus(static_cast<uint32_t>(cpu));
+        }
+        numa_node->set_memory_total_bytes(node.memory_total);
+        numa_node->set_memory_free_bytes(node.memory_free);
+    }
+    response->set_load_1m(host.load_average[0]);
+    response->set_load_5m(host.load_average[1]);
+    response->set_load_15m(host.load_average[2]);
+}
@@ -0,0 +1,53 @@
+#ifndef RESOURCE_PROBE_H
+#define RESOURCE_PROBE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "server_communication.pb.h"
+
+struct NumaNodeInfo {
+    int id = 0;
+    std::vector<int> cpus;         // Logical CPUs on this node
+    uint64_t memory_total = 0;     // Bytes
+    uint64_t memory_free = 0;      // Bytes
+};
+
+struct CacheInfo {
+    unsigned level = 0;
+    std::string type;              // "Data", "Instruction" or "Unified"
+    uint64_t size = 0;             // Bytes per instance
+    unsigned shared_cpus = 0;      // Logical CPUs sharing one instance
+};
+
+// CPU, memory, NUMA and load information of the machine this process runs on
+struct HostResources {
+    std::string cpu_model;
+    unsigned logical_cpus = 0;
+    unsigned physical_cores = 0;
+    unsigned sockets = 0;
+    unsigned threads_per_core = 0;
+    std::vector<CacheInfo> caches;         // As seen from CPU 0
+    std::vector<std::string> isa_flags;    // Vector ISA extensions relevant to kernel choice
+    unsigned usable_cpus = 0;      // CPUs this process may run on, after affinity and cpusets
+    uint64_t memory_total = 0;     // Bytes
+    uint64_t memory_available = 0; // Bytes; 0 if the platform does not report it
+    std::vector<NumaNodeInfo> numa_nodes;  // A single node on machines without NUMA
+    double load_average[3] = {0.0, 0.0, 0.0};  // 1, 5 and 15 minutes
+};
+
+// Read the host's resources from /proc and sysfs on Linux and sysctl on macOS, without spawning
+// any processes. Fields the platform does not expose are left at zero.
+HostResources probe_host_resources();
+
+// Fill a GetResources response from a probe, so local and remote discovery report alike
+void host_resources_to_proto(const HostResources& host, leaftest::ResourcesResponse* response);
+
+// Widest SIMD register in bits among the flags (512 for AVX-512, 256 for AVX2, 128 for SSE4.2,
+// NEON or SVE, whose length is implementation defined), or 0 if none is known
+unsigned vector_width_bits(const std::vector<std::string>& isa_flags);
+
+// Parse a sysfs CPU list such as "0-3,8,10-11"
+std::vector<int> parse_cpu_list(const std::string& list);
+
+#endif // RESOURCE_PROBE_H
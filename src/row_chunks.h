@@ -0,0 +1,23 @@
+#ifndef ROW_CHUNKS_H
+#define ROW_CHUNKS_H
+
+#include <algorithm>
+#include <cstddef>
+
+// How forward_pass_on_server splits an input along its batch dimension: every chunk holds whole
+// samples and at most max_chunk_bytes (at least one sample), so outputs concatenate back in order
+struct RowChunks {
+    size_t rows_per_chunk;
+    size_t num_chunks;
+};
+
+constexpr size_t forward_chunk_bytes = 32 * 1024;  // 32KB - reasonable chunk size
+
+inline RowChunks plan_row_chunks(size_t num_rows, size_t row_elems, size_t max_chunk_bytes = forward_chunk_bytes) {
+    size_t row_bytes = std::max<size_t>(1, row_elems * sizeof(float));
+    size_t rows_per_chunk = std::max<size_t>(1, max_chunk_bytes / row_bytes);
+    size_t num_chunks = std::max<size_t>(1, (num_rows + rows_per_chunk - 1) / rows_per_chunk);
+    return {rows_per_chunk, num_chunks};
+}
+
+#endif // ROW_CHUNKS_H
@@ -1,4 +1,7 @@
 #include "server.h"
+#include "resource_probe.h"
+#include <iomanip>
+#include <sstream>
 
 // ComputeResource implementation
 ComputeResource::ComputeResource(const std::string& n, const std::string& t)
@@ -23,25 +26,154 @@ Server::Server(const std::string& server_name, const UserCredentials& creds, boo
     }
 }
 
+Server::Server(const std::string& server_name, const std::string& server_endpoint)
+    : name(server_name), credentials("", "", 0, ""), is_connected(false), is_local(false),
+      endpoint(server_endpoint) {
+    // Reachable means it answers GetResources, which also fills in its resources
+    is_connected = fetch_remote_resources();
+}
+
+static std::string format_mib(uint64_t bytes) {
+    return std::to_string(bytes / (1024 * 1024)) + " MiB";
+}
+
+static std::string format_load(double load) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << load;
+    return out.str();
+}
+
+// Compress a CPU list back into sysfs notation, e.g. "0-15,32-47"
+static std::string format_cpu_list(const google::protobuf::RepeatedField<uint32_t>& cpus) {
+    std::string list;
+    for (int i = 0; i < cpus.size();) {
+        int j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+            ++j;
+        }
+        if (!list.empty()) {
+            list += ",";
+        }
+        list += std::to_string(cpus[i]);
+        if (j > i) {
+            list += "-" + std::to_string(cpus[j]);
+        }
+        i = j + 1;
+    }
+    return list;
+}
+
+bool Server::fetch_remote_resources() {
+    std::string address = endpoint;
+    if (address.empty()) {
+        if (credentials.get_tunnel_port() <= 0) {
+            return false;
+        }
+        address = "localhost:" + std::to_string(credentials.get_tunnel_port());
+    }
+    auto channel = grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
+    auto stub = leaftest::ServerCommunication::NewStub(channel);
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(10));
+    leaftest::ResourcesRequest request;
+    leaftest::ResourcesResponse response;
+    grpc::Status status = stub->GetResources(&context, request, &response);
+    if (!status.ok() || !response.success()) {
+        return false;
+    }
+    add_host_resources(response);
+    return true;
+}
+
+void Server::add_host_resources(const leaftest::ResourcesResponse& response) {
+    ComputeResource cpu(response.cpu_model().empty() ? "CPU" : response.cpu_model(), "CPU");
+    cpu.add_property("logical_cpus", std::to_string(response.logical_cpus()));
+    cpu.add_property("physical_cores", std::to_string(response.physical_cores()));
+    cpu.add_property("sockets", std::to_string(response.sockets()));
+    cpu.add_property("threads_per_core", std::to_string(response.threads_per_core()));
+    cpu.add_property("usable_cpus", std::to_string(response.usable_cpus()));
+    cpu.add_property("numa_nodes", std::to_string(response.numa_nodes_size()));
+    cpu.add_property("total_memory", format_mib(response.memory_total_bytes()));
+    cpu.add_property("available_memory", format_mib(response.memory_available_bytes()));
+    cpu.add_property("load_1m", format_load(response.load_1m()));
+    cpu.add_property("load_5m", format_load(response.load_5m()));
+    cpu.add_property("load_15m", format_load(response.load_15m()));
+    // e.g. l1d_cache = "48 KiB (shared by 2 CPUs)"; the trainer sizes shards from these
+    for (const auto& cache : response.caches()) {
+        std::string key = "l" + std::to_string(cache.level());
+        if (cache.type() == "Data") {
+            key += "d";
+        } else if (cache.type() == "Instruction") {
+            key += "i";
+        }
+        std::string value = std::to_string(cache.size_bytes() / 1024) + " KiB";
+        if (cache.shared_cpus() > 1) {
+            value += " (shared by " + std::to_string(cache.shared_cpus()) + " CPUs)";
+        }
+        cpu.add_property(key + "_cache", value);
+    }
+    std::vector<std::string> isa_flags(response.isa_flags().begin(), response.isa_flags().end());
+    std::string flags;
+    for (const auto& flag : isa_flags) {
+        flags += (flags.empty() ? "" : " ") + flag;
+    }
+    cpu.add_property("isa_flags", flags);
+    cpu.add_property("vector_bits", std::to_string(vector_width_bits(isa_flags)));
+    resources.push_back(cpu);
+
+    // Single-node machines are fully described by the CPU entry
+    if (response.numa_nodes_size() > 1) {
+        for (const auto& node : response.numa_nodes()) {
+            ComputeResource numa("NUMA node " + std::to_string(node.id()), "NUMA");
+            numa.add_property("cpus", format_cpu_list(node.cpus()));
+            numa.add_property("total_memory", format_mib(node.memory_total_bytes()));
+            numa.add_property("free_memory", format_mib(node.memory_free_bytes()));
+            resources.push_back(numa);
+        }
+    }
+
+    for (const auto& device : response.gpus()) {
+        ComputeResource gpu(device.name(), "GPU");
+        gpu.add_property("index", std::to_string(device.index()));
+        gpu.add_property("total_memory", format_mib(device.memory_total_bytes()));
+        gpu.add_property("reserved_memory", format_mib(device.memory_reserved_bytes()));
+        resources.push_back(gpu);
+    }
+
+    if (response.mps_available()) {
+        ComputeResource mps("Metal Performance Shaders", "MPS");
+        mps.add_property("status", "Available");
+        resources.push_back(mps);
+    }
+}
+
 void Server::discover_resources() {
     if (!is_connected && !is_local) return;
+    resources.clear();
+
+    // One RPC replaces the shell probes below; they remain for accelerators on the local machine
+    // and for servers still running an image without GetResources
+    if (!is_local && fetch_remote_resources()) {
+        return;
+    }
+    if (!endpoint.empty()) {
+        // No SSH connection to probe through
+        return;
+    }
 
-    // Discover CPU information
+    // Discover CPU information; the local machine is probed natively, like the servers probe themselves
     std::string cpu_cmd;
     if (is_local) {
-        cpu_cmd = "sysctl -n machdep.cpu.brand_string 2>/dev/null";
+        leaftest::ResourcesResponse host;
+        host_resources_to_proto(probe_host_resources(), &host);
+        add_host_resources(host);
     } else {
-        cpu_cmd = "ssh -o BatchMode=yes -o StrictHostKeyChecking=no -o ConnectTimeout=10 ";
-        if (!credentials.get_key_path().empty()) {
-            cpu_cmd += "-i " + credentials.get_key_path() + " ";
-        }
-        cpu_cmd += "-p " + std::to_string(credentials.get_port()) + " ";
-        cpu_cmd += credentials.get_username() + "@" + credentials.get_hostname() + " 'sysctl -n machdep.cpu.brand_string 2>/dev/null'";
+        cpu_cmd = credentials.ssh_command("sysctl -n machdep.cpu.brand_string 2>/dev/null");
     }
 
     std::array<char, 128> buffer;
     std::string cpu_result;
-    std::unique_ptr<FILE, decltype(&pclose)> cpu_pipe(popen(cpu_cmd.c_str(), "r"), pclose);
+    std::unique_ptr<FILE, decltype(&pclose)> cpu_pipe(cpu_cmd.empty() ? nullptr : popen(cpu_cmd.c_str(), "r"), pclose);
     
     if (cpu_pipe) {
         while (fgets(buffer.data(), buffer.size(), cpu_pipe.get()) != nullptr) {
@@ -62,12 +194,7 @@ void Server::discover_resources() {
     if (is_local) {
         mps_cmd = "system_profiler SPDisplaysDataType 2>/dev/null | grep 'Metal:' 2>/dev/null";
     } else {
-        mps_cmd = "ssh -o BatchMode=yes -o StrictHostKeyChecking=no -o ConnectTimeout=10 ";
-        if (!credentials.get_key_path().empty()) {
-            mps_cmd += "-i " + credentials.get_key_path() + " ";
-        }
-        mps_cmd += "-p " + std::to_string(credentials.get_port()) + " ";
-        mps_cmd += credentials.get_username() + "@" + credentials.get_hostname() + " 'system_profiler SPDisplaysDataType 2>/dev/null | grep \"Metal:\" 2>/dev/null'";
+        mps_cmd = credentials.ssh_command("system_profiler SPDisplaysDataType 2>/dev/null | grep \"Metal:\" 2>/dev/null");
     }
 
     std::string mps_result;
@@ -90,12 +217,7 @@ void Server::discover_resources() {
         gpu_cmd = "nvidia-smi --query-gpu=name,memory.total,memory.free --format=csv,noheader 2>/dev/null";
     } else {
         // For remote servers, we need to ensure the command is properly escaped and executed
-        gpu_cmd = "ssh -o BatchMode=yes -o StrictHostKeyChecking=no -o ConnectTimeout=10 ";
-        if (!credentials.get_key_path().empty()) {
-            gpu_cmd += "-i " + credentials.get_key_path() + " ";
-        }
-        gpu_cmd += "-p " + std::to_string(credentials.get_port()) + " ";
-        gpu_cmd += credentials.get_username() + "@" + credentials.get_hostname() + " 'nvidia-smi --query-gpu=name,memory.total,memory.free --format=csv,noheader 2>/dev/null'";
+        gpu_cmd = credentials.ssh_command("nvidia-smi --query-gpu=name,memory.total,memory.free --format=csv,noheader 2>/dev/null");
     }
 
     std::string gpu_result;
@@ -128,12 +250,7 @@ void Server::discover_resources() {
         if (is_local) {
             simple_gpu_cmd = "nvidia-smi 2>/dev/null | grep 'NVIDIA'";
         } else {
-            simple_gpu_cmd = "ssh -o BatchMode=yes -o StrictHostKeyChecking=no -o ConnectTimeout=10 ";
-            if (!credentials.get_key_path().empty()) {
-                simple_gpu_cmd += "-i " + credentials.get_key_path() + " ";
-            }
-            simple_gpu_cmd += "-p " + std::to_string(credentials.get_port()) + " ";
-            simple_gpu_cmd += credentials.get_username() + "@" + credentials.get_hostname() + " 'nvidia-smi 2>/dev/null | grep \"NVIDIA\"'";
+            simple_gpu_cmd = credentials.ssh_command("nvidia-smi 2>/dev/null | grep \"NVIDIA\"");
         }
 
         std::string simple_gpu_result;
@@ -30,8 +30,13 @@ private:
     std::vector<ComputeResource> resources;
     bool is_connected;
     bool is_local;
+    std::string endpoint;  // host:port of a server registered directly; empty when reached over SSH
 
     void discover_resources();
+    // Ask the server's GetResources RPC at its endpoint or over the tunnel; false if it is
+    // unreachable or predates it
+    bool fetch_remote_resources();
+    void add_host_resources(const leaftest::ResourcesResponse& host);
 
 public:
     // Default constructor required for std::map
@@ -40,11 +45,21 @@ public:
     // Main constructor
     Server(const std::string& server_name, const UserCredentials& creds, bool local = false);
 
+    // A server process that is already running and reachable at endpoint (host:port), e.g. one
+    // started on this machine; no SSH, tunnel or container is involved
+    Server(const std::string& server_name, const std::string& endpoint);
+
     bool is_server_connected() const { return is_connected; }
     bool is_local_server() const { return is_local; }
     std::string get_name() const { return name; }
     UserCredentials get_credentials() const { return credentials; }
+    std::string get_endpoint() const { return endpoint; }
     std::vector<ComputeResource> get_resources() const { return resources; }
+
+    // Re-read the resources, e.g. to pick up current load and free memory before scheduling
+    void refresh_resources() { discover_resources(); }
+    // Take the resources another copy of this server discovered
+    void set_resources(const std::vector<ComputeResource>& discovered) { resources = discovered; }
 };
 
 #endif // SERVER_H 
\ No newline at end of file
@@ -6,8 +6,24 @@
 #include "server_communication.grpc.pb.h"
 #include "server_communication.h"
 #include "model.h"
+#include "forward_batcher.h"
+#include "checkpoint.h"
+#include "resource_probe.h"
+#include "numa_placement.h"
+#include "metrics.h"
+#include "logging.h"
+#include "trace.h"
+#include <cerrno>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <csignal>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
+#include <pybind11/embed.h>
 
 using grpc::ServerBuilder;
 using grpc::ServerContext;
@@ -21,16 +37,117 @@ using leaftest::GradientRequest;
 using leaftest::GradientResponse;
 using leaftest::StoreModelWeightsRequest;
 using leaftest::StoreModelWeightsResponse;
+using leaftest::SaveCheckpointRequest;
+using leaftest::SaveCheckpointResponse;
+using leaftest::ResourcesRequest;
+using leaftest::ResourcesResponse;
+using leaftest::HeartbeatRequest;
+using leaftest::HeartbeatResponse;
+using leaftest::MetricsRequest;
+using leaftest::MetricsResponse;
+using leaftest::InitShardRequest;
+using leaftest::InitShardResponse;
+using leaftest::PushGradientsRequest;
+using leaftest::PushGradientsResponse;
+using leaftest::PullParametersRequest;
+using leaftest::PullParametersResponse;
+using leaftest::StoreDataShardRequest;
+using leaftest::StoreDataShardResponse;
+using leaftest::LocalTrainRequest;
+using leaftest::LocalTrainResponse;
+using leaftest::ComputeGradientsRequest;
+using leaftest::ComputeGradientsResponse;
 
 namespace py = pybind11;
 
+// torch.load() a module serialized with torch.save(); caller holds the GIL
+static py::object load_module(const std::string& bytes, py::object map_location) {
+    py::object torch = py::module_::import("torch");
+    py::object buffer = py::module_::import("io").attr("BytesIO")(py::bytes(bytes));
+    return torch.attr("load")(buffer, py::arg("map_location") = map_location, py::arg("weights_only") = false);
+}
+
+ServerCommunicationServiceImpl::ServerCommunicationServiceImpl(const ServerOptions& options)
+    : stored_models(options.model_store), batcher(options.batching), output_cache(options.output_cache_bytes),
+      role(options.role), checkpoint_interval(options.checkpoint_interval), checkpoint_dirty(false),
+      checkpoint_stopping(false) {
+    if (!options.checkpoint_dir.empty()) {
+        checkpoint_path = options.checkpoint_dir + "/models.leafckpt";
+        if (checkpoint_interval.count() > 0) {
+            checkpoint_thread = std::thread(&ServerCommunicationServiceImpl::run_periodic_checkpoints, this);
+        }
+    }
+}
+
+ServerCommunicationServiceImpl::~ServerCommunicationServiceImpl() {
+    {
+        std::lock_guard<std::mutex> lock(checkpoint_mutex);
+        checkpoint_stopping = true;
+    }
+    checkpoint_cv.notify_all();
+    if (checkpoint_thread.joinable()) {
+        checkpoint_thread.join();
+    }
+}
+
+void ServerCommunicationServiceImpl::mark_checkpoint_dirty() {
+    std::lock_guard<std::mutex> lock(checkpoint_mutex);
+    checkpoint_dirty = true;
+}
+
+// Checkpoint changed models every checkpoint_interval, and once more on shutdown so the last
+// updates are not lost. Runs without the GIL; the snapshot acquires it.
+void ServerCommunicationServiceImpl::run_periodic_checkpoints() {
+    std::unique_lock<std::mutex> lock(checkpoint_mutex);
+    while (true) {
+        bool stopping = checkpoint_cv.wait_for(lock, checkpoint_interval, [this] { return checkpoint_stopping; });
+        if (checkpoint_dirty) {
+            lock.unlock();
+            try {
+                save_checkpoint();
+            } catch (const std::exception& e) {
+                LEAF_LOG_WARN("Periodic checkpoint failed: " << e.what());
+                mark_checkpoint_dirty();
+            }
+            lock.lock();
+        }
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+// Optimizer settings of a request; unset betas and epsilon only matter to Adam and AdamW, whose
+// clients always send them
+static OptimizerOptions optimizer_options(const leaftest::ShardOptimizer& optimizer) {
+    OptimizerOptions options;
+    options.kind = optimizer.kind().empty() ? OptimizerKind::SGD : parse_optimizer_kind(optimizer.kind());
+    options.learning_rate = optimizer.learning_rate();
+    options.momentum = optimizer.momentum();
+    options.nesterov = optimizer.nesterov();
+    options.weight_decay = optimizer.weight_decay();
+    if (options.kind != OptimizerKind::SGD) {
+        options.beta1 = optimizer.beta1();
+        options.beta2 = optimizer.beta2();
+        options.epsilon = optimizer.epsilon();
+    }
+    return options;
+}
+
 Status ServerCommunicationServiceImpl::GetServerTime(ServerContext* /*context*/, const TimeRequest* /*request*/, TimeResponse* response) {
     response->set_server_time_ms(123456789);  // fixed demo value
     return Status::OK;
 }
 
 Status ServerCommunicationServiceImpl::StoreModelWeights(ServerContext* /*context*/, const StoreModelWeightsRequest* request, StoreModelWeightsResponse* response) {
+    static RpcMetrics rpc("StoreModelWeights");
+    static Histogram& deserialize_us = metrics().histogram("store.deserialize_us");
+    RpcScope<StoreModelWeightsRequest, StoreModelWeightsResponse> scope(rpc, *request, *response);
+    ServerLoad::Request in_flight(load, false);
     try {
+        if (role == ServerRole::ParameterServer) {
+            throw std::runtime_error("Server runs as a parameter server only");
+        }
         std::string model_id = request->model_id();
         
         // Deserialize model state from bytes to vector<float>
@@ -39,24 +156,43 @@ Status ServerCommunicationServiceImpl::StoreModelWeights(ServerContext* /*contex
         std::vector<float> model_state(num_floats);
         
         if (model_state_bytes.size() > 0) {
+            ScopedTimer timer(deserialize_us);
             std::memcpy(model_state.data(), model_state_bytes.data(), model_state_bytes.size());
         }
         
-        // Create a new Model object with the deserialized state
-        // Note: We need to create a dummy PyTorch model here since we can't easily reconstruct it from just the weights
-        // In a real implementation, you might want to store the model architecture information as well
-        py::object dummy_model = py::none();  // Placeholder for now
-        auto model = std::make_shared<Model>(dummy_model, nullptr);
-        
-        // Store the model
-        stored_models[model_id] = model;
+        std::lock_guard<std::mutex> training_lock(local_train_mutex);
+        if (request->model_definition().empty() && stored_models.has_architecture(model_id)) {
+            // Weight update for a model whose architecture we already have; copy-on-write if a
+            // checkpoint is still being written from the current weights
+            stored_models.update_weights(model_id, model_state.data(), model_state.size());
+        } else {
+            // gRPC worker threads do not hold the GIL, and replacing a stored model releases its Python object
+            py::gil_scoped_acquire gil;
+            std::shared_ptr<Model> model;
+            if (!request->model_definition().empty()) {
+                // Rebuild the module the client torch.save()d so forward passes run the real architecture
+                py::object module = load_module(request->model_definition(), py::str("cpu"));
+                model = std::make_shared<Model>(module, nullptr);
+                // Outputs of the previous module are meaningless for the new one
+                output_cache.remove_model(model_id);
+            } else {
+                // Without an architecture we can only keep a placeholder
+                model = std::make_shared<Model>(py::none(), nullptr);
+            }
+            
+            // Store the model
+            store_model(model_id, model);
+        }
+        model_versions[model_id] = request->version();
+        mark_checkpoint_dirty();
         
-        std::cout << "Stored model for model ID: " << model_id 
-                  << ", size: " << model_state.size() << " parameters" << std::endl;
+        LEAF_LOG_DEBUG("Stored model for model ID: " << model_id
+                       << ", size: " << model_state.size() << " parameters");
         
         response->set_success(true);
         response->set_error_message("");
         response->set_model_id(model_id);
+        response->set_version(request->version());
         
         return Status::OK;
     } catch (const std::exception& e) {
@@ -67,115 +203,129 @@ Status ServerCommunicationServiceImpl::StoreModelWeights(ServerContext* /*contex
     }
 }
 
+Status ServerCommunicationServiceImpl::SaveCheckpoint(ServerContext* /*context*/, const SaveCheckpointRequest* request, SaveCheckpointResponse* response) {
+    static RpcMetrics rpc("SaveCheckpoint");
+    RpcScope<SaveCheckpointRequest, SaveCheckpointResponse> scope(rpc, *request, *response);
+    try {
+        size_t model_count = save_checkpoint();
+        response->set_model_count(static_cast<uint32_t>(model_count));
+        response->set_path(checkpoint_path);
+        
+        std::string error;
+        if (request->wait() && !checkpoint_writer.flush(&error)) {
+            response->set_success(false);
+            response->set_error_message(error);
+            return Status::OK;
+        }
+        LEAF_LOG_INFO("SaveCheckpoint: Queued " << model_count << " models for " << checkpoint_path);
+        
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+// Why input_data and input_shape do not describe a float32 tensor, or empty if they do. Checked
+// before batching, since one malformed request would otherwise fail the forward of every request
+// coalesced with it.
+static std::string invalid_forward_input(const ForwardPassRequest& request) {
+    size_t bytes = request.input_data().size();
+    if (bytes % sizeof(float) != 0) {
+        return "Input data is " + std::to_string(bytes) + " bytes, not a whole number of float32 values";
+    }
+    if (request.input_shape_size() == 0) {
+        return "";
+    }
+    uint64_t count = bytes / sizeof(float);
+    uint64_t elements = 1;
+    std::string mismatch = "Input shape does not match the " + std::to_string(count) + " values sent";
+    for (int64_t dim : request.input_shape()) {
+        if (dim <= 0) {
+            return "Input shape has non-positive dimension " + std::to_string(dim);
+        }
+        // Compared by division so a huge shape cannot overflow the product
+        if (static_cast<uint64_t>(dim) > count / elements) {
+            return mismatch;
+        }
+        elements *= static_cast<uint64_t>(dim);
+    }
+    return elements == count ? "" : mismatch;
+}
+
 Status ServerCommunicationServiceImpl::ForwardPass(ServerContext* /*context*/, const ForwardPassRequest* request, ForwardPassResponse* response) {
+    static RpcMetrics rpc("ForwardPass");
+    RpcScope<ForwardPassRequest, ForwardPassResponse> scope(rpc, *request, *response);
+    ServerTraceSpan span(request->trace() ? response->mutable_trace_events() : nullptr, "ForwardPass", "server");
+    ServerLoad::Request in_flight(load);
     try {
+        if (role == ServerRole::ParameterServer) {
+            throw std::runtime_error("Server runs as a parameter server only");
+        }
         uint32_t model_index = request->model_index();
-        std::cout << "ForwardPass: Starting for model index " << model_index << std::endl;
+        LEAF_LOG_DEBUG("ForwardPass: Starting for model index " << model_index);
         
         // Get the model ID based on the index
         std::string model_id = "model_" + std::to_string(model_index);
-        std::cout << "ForwardPass: Looking for model_id: " << model_id << std::endl;
+        LEAF_LOG_DEBUG("ForwardPass: Looking for model_id: " << model_id);
         
         // Check if the model exists
         if (!has_model(model_id)) {
-            std::cout << "ForwardPass: ERROR - Model " << model_id << " not found" << std::endl;
+            LEAF_LOG_ERROR("ForwardPass: Model " << model_id << " not found");
             response->set_success(false);
             response->set_error_message("Model with index " + std::to_string(model_index) + " not found");
             return Status::OK;
         }
-        std::cout << "ForwardPass: Model " << model_id << " found" << std::endl;
+        LEAF_LOG_DEBUG("ForwardPass: Model " << model_id << " found");
         
         // Get the model
         auto model = get_model(model_id);
         if (!model) {
-            std::cout << "ForwardPass: ERROR - Failed to retrieve model " << model_id << std::endl;
+            LEAF_LOG_ERROR("ForwardPass: Failed to retrieve model " << model_id);
             response->set_success(false);
             response->set_error_message("Failed to retrieve model with index " + std::to_string(model_index));
             return Status::OK;
         }
-        std::cout << "ForwardPass: Model " << model_id << " retrieved successfully" << std::endl;
+        LEAF_LOG_DEBUG("ForwardPass: Model " << model_id << " retrieved successfully");
         
         // Deserialize input data from request into a numpy array
         const std::string& input_bytes = request->input_data();
         if (input_bytes.empty()) {
-            std::cout << "ForwardPass: ERROR - No input data provided" << std::endl;
+            LEAF_LOG_ERROR("ForwardPass: No input data provided");
             response->set_success(false);
             response->set_error_message("No input data provided");
             return Status::OK;
         }
-        std::cout << "ForwardPass: Input data size: " << input_bytes.size() << " bytes" << std::endl;
-        
-        try {
-            py::object numpy = py::module_::import("numpy");
-            std::cout << "ForwardPass: NumPy imported successfully" << std::endl;
-        } catch (const std::exception& e) {
-            std::cout << "ForwardPass: ERROR - Failed to import numpy: " << e.what() << std::endl;
+        LEAF_LOG_DEBUG("ForwardPass: Input data size: " << input_bytes.size() << " bytes");
+        std::string input_error = invalid_forward_input(*request);
+        if (!input_error.empty()) {
+            LEAF_LOG_ERROR("ForwardPass: " << input_error);
             response->set_success(false);
-            response->set_error_message("Failed to import numpy: " + std::string(e.what()));
+            response->set_error_message(input_error);
             return Status::OK;
         }
         
-        try {
-            py::object torch = py::module_::import("torch");
-            std::cout << "ForwardPass: PyTorch imported successfully" << std::endl;
-        } catch (const std::exception& e) {
-            std::cout << "ForwardPass: ERROR - Failed to import torch: " << e.what() << std::endl;
-            response->set_success(false);
-            response->set_error_message("Failed to import torch: " + std::string(e.what()));
-            return Status::OK;
-        }
+        // Queue the request with the batcher; it runs one forward for all concurrent requests
+        // on this model and writes our rows of the output into the response
+        batcher.submit(model_id, model, *request, response);
         
-        py::object numpy = py::module_::import("numpy");
-        py::object torch = py::module_::import("torch");
-        
-        py::object input_tensor;
-        try {
-            // Create numpy array from raw bytes (float32)
-            py::object np_float32 = numpy.attr("dtype")("float32");
-            py::object input_array = numpy.attr("frombuffer")(py::bytes(input_bytes), np_float32);
-            std::cout << "ForwardPass: Input array created from bytes successfully" << std::endl;
-            
-            // Convert numpy array to torch tensor
-            input_tensor = torch.attr("from_numpy")(input_array).attr("float")();
-            std::cout << "ForwardPass: Input tensor created successfully" << std::endl;
-            
-            // Ensure batch dimension exists (if caller sent flat tensor we treat it as batch size 1)
-            if (input_tensor.attr("dim")().cast<int>() == 1) {
-                input_tensor = input_tensor.attr("unsqueeze")(0);
-                std::cout << "ForwardPass: Added batch dimension to input tensor" << std::endl;
+        if (response->success()) {
+            // Keep the output for the loss/backward phase if the caller asked for it
+            if (!request->request_id().empty()) {
+                CachedOutput output;
+                output.model_id = model_id;
+                output.data = response->output_data();
+                output.shape.assign(response->output_shape().begin(), response->output_shape().end());
+                output_cache.put(request->request_id(), std::move(output));
             }
-            
-            std::cout << "ForwardPass: Input tensor shape: " << py::str(input_tensor.attr("shape")).cast<std::string>() << std::endl;
-        } catch (const std::exception& e) {
-            std::cout << "ForwardPass: ERROR - Failed to create input tensor: " << e.what() << std::endl;
-            response->set_success(false);
-            response->set_error_message("Failed to create input tensor: " + std::string(e.what()));
-            return Status::OK;
-        }
-        
-        try {
-            // Run forward pass using the stored PyTorch model
-            py::object pytorch_model = model->get_pytorch_model();
-            std::cout << "ForwardPass: Retrieved PyTorch model successfully" << std::endl;
-            
-            py::object output_tensor = pytorch_model.attr("forward")(input_tensor);
-            std::cout << "ForwardPass: Forward pass completed successfully" << std::endl;
-            
-            // Just return true if the forward pass worked
-            response->set_success(true);
-            response->set_error_message("");
-            
-            std::cout << "ForwardPass: Completed successfully for model index " << model_index << std::endl;
-            
-            return Status::OK;
-        } catch (const std::exception& e) {
-            std::cout << "ForwardPass: ERROR - Forward pass failed: " << e.what() << std::endl;
-            response->set_success(false);
-            response->set_error_message("Forward pass failed: " + std::string(e.what()));
-            return Status::OK;
+            LEAF_LOG_DEBUG("ForwardPass: Completed successfully for model index " << model_index);
         }
+        return Status::OK;
     } catch (const std::exception& e) {
-        std::cout << "ForwardPass: ERROR - Unexpected error: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("ForwardPass: Unexpected error: " << e.what());
         response->set_success(false);
         response->set_error_message("Unexpected error: " + std::string(e.what()));
         return Status::OK;
@@ -183,13 +333,28 @@ Status ServerCommunicationServiceImpl::ForwardPass(ServerContext* /*context*/, c
 }
 
 Status ServerCommunicationServiceImpl::GetGradients(ServerContext* /*context*/, const GradientRequest* request, GradientResponse* response) {
+    static RpcMetrics rpc("GetGradients");
+    RpcScope<GradientRequest, GradientResponse> scope(rpc, *request, *response);
+    ServerTraceSpan span(request->trace() ? response->mutable_trace_events() : nullptr, "GetGradients", "server");
+    ServerLoad::Request in_flight(load);
     try {
-        // For now, we'll return a dummy response
+        if (role == ServerRole::ParameterServer) {
+            throw std::runtime_error("Server runs as a parameter server only");
+        }
+        // For now, we'll return a dummy response; it gets a "backward" span once it runs one
         // In a real implementation, this would:
         // 1. Deserialize input data from request->input_data()
         // 2. Use the stored model to compute gradients
         // 3. Return the gradients and loss
         
+        // The backward phase is the last reader of a retained forward output, so release it here
+        if (!request->request_id().empty()) {
+            std::vector<CachedOutput> outputs;
+            if (take_outputs(request->request_id(), &outputs) == 0) {
+                LEAF_LOG_DEBUG("GetGradients: No retained output for request " << request->request_id());
+            }
+        }
+        
         // Dummy implementation
         response->set_gradients("dummy_gradients");
         response->set_loss(0.5f);
@@ -206,47 +371,369 @@ Status ServerCommunicationServiceImpl::GetGradients(ServerContext* /*context*/,
 
 // Helper methods for model management
 bool ServerCommunicationServiceImpl::has_model(const std::string& model_id) const {
-    return stored_models.find(model_id) != stored_models.end();
+    return stored_models.contains(model_id);
 }
 
-std::shared_ptr<Model> ServerCommunicationServiceImpl::get_model(const std::string& model_id) const {
-    auto it = stored_models.find(model_id);
-    if (it != stored_models.end()) {
-        return it->second;
-    }
-    return nullptr;
+std::shared_ptr<Model> ServerCommunicationServiceImpl::get_model(const std::string& model_id) {
+    // Faults a spilled model back in; the returned pointer keeps it resident while in use
+    return stored_models.get(model_id);
 }
 
 void ServerCommunicationServiceImpl::store_model(const std::string& model_id, std::shared_ptr<Model> model) {
-    stored_models[model_id] = model;
+    stored_models.put(model_id, model);
 }
 
 void ServerCommunicationServiceImpl::remove_model(const std::string& model_id) {
-    stored_models.erase(model_id);
+    stored_models.remove(model_id);
 }
 
 std::vector<std::string> ServerCommunicationServiceImpl::get_stored_model_ids() const {
-    std::vector<std::string> ids;
-    for (const auto& pair : stored_models) {
-        ids.push_back(pair.first);
-    }
-    return ids;
+    return stored_models.ids();
 }
 
+Status ServerCommunicationServiceImpl::GetResources(ServerContext* /*context*/, const ResourcesRequest* request, ResourcesResponse* response) {
+    static RpcMetrics rpc("GetResources");
+    RpcScope<ResourcesRequest, ResourcesResponse> scope(rpc, *request, *response);
+    try {
+        host_resources_to_proto(probe_host_resources(), response);
 
-std::vector<float> ServerCommunicationServiceImpl::get_outputs(const std::string& model_id) const {
-    auto it = model_outputs.find(model_id);
-    if (it != model_outputs.end()) {
-        return it->second;
+        // Accelerators are read through torch; memory_reserved() does not create a CUDA context
+        // on devices the server has not used yet, unlike mem_get_info()
+        py::gil_scoped_acquire gil;
+        py::object torch = py::module_::import("torch");
+        if (torch.attr("cuda").attr("is_available")().cast<bool>()) {
+            int device_count = torch.attr("cuda").attr("device_count")().cast<int>();
+            for (int i = 0; i < device_count; ++i) {
+                py::object properties = torch.attr("cuda").attr("get_device_properties")(i);
+                auto* gpu = response->add_gpus();
+                gpu->set_index(static_cast<uint32_t>(i));
+                gpu->set_name(properties.attr("name").cast<std::string>());
+                gpu->set_memory_total_bytes(properties.attr("total_memory").cast<uint64_t>());
+                gpu->set_memory_reserved_bytes(torch.attr("cuda").attr("memory_reserved")(i).cast<uint64_t>());
+            }
+        }
+        py::object backends = torch.attr("backends");
+        response->set_mps_available(py::hasattr(backends, "mps") &&
+                                    backends.attr("mps").attr("is_available")().cast<bool>());
+
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
     }
-    return {};
 }
 
-int main(int /*argc*/, char** /*argv*/) {
-    const std::string addr("0.0.0.0:50051");
-    ServerCommunicationServiceImpl service;
-    ServerBuilder builder;
+Status ServerCommunicationServiceImpl::Heartbeat(ServerContext* context, const HeartbeatRequest* request, grpc::ServerWriter<HeartbeatResponse>* writer) {
+    auto interval = std::chrono::milliseconds(std::min<uint32_t>(std::max<uint32_t>(request->interval_ms(), 50), 10000));
+    ProcessUsage previous = read_process_usage();
+    auto previous_time = std::chrono::steady_clock::now();
+    uint64_t sequence = 0;
     
+    // Streams until the trainer cancels; a failed Write means it has gone away
+    while (!context->IsCancelled()) {
+        ProcessUsage usage = read_process_usage();
+        auto now = std::chrono::steady_clock::now();
+        double wall_seconds = std::chrono::duration<double>(now - previous_time).count();
+        
+        HeartbeatResponse heartbeat;
+        heartbeat.set_sequence(sequence++);
+        heartbeat.set_server_time_ms(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        heartbeat.set_queue_depth(static_cast<uint32_t>(batcher.queue_depth()));
+        heartbeat.set_in_flight_requests(load.get_in_flight());
+        heartbeat.set_completed_requests(load.get_completed());
+        for (float step_ms : load.recent_step_times_ms()) {
+            heartbeat.add_recent_step_ms(step_ms);
+        }
+        heartbeat.set_cpu_percent(wall_seconds > 0 ? 100.0 * (usage.cpu_seconds - previous.cpu_seconds) / wall_seconds : 0.0);
+        heartbeat.set_rss_bytes(usage.rss_bytes);
+        if (!writer->Write(heartbeat)) {
+            break;
+        }
+        previous = usage;
+        previous_time = now;
+        std::this_thread::sleep_for(interval);
+    }
+    return Status::OK;
+}
+
+Status ServerCommunicationServiceImpl::GetMetrics(ServerContext* /*context*/, const MetricsRequest* /*request*/, MetricsResponse* response) {
+    try {
+        metrics_to_proto(metrics().snapshot(), response);
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+Status ServerCommunicationServiceImpl::InitParameterShard(ServerContext* /*context*/, const InitShardRequest* request, InitShardResponse* response) {
+    static RpcMetrics rpc("InitParameterShard");
+    RpcScope<InitShardRequest, InitShardResponse> scope(rpc, *request, *response);
+    try {
+        if (role == ServerRole::Worker) {
+            throw std::runtime_error("Server was not started with --role parameter-server or both");
+        }
+        ShardOptions options;
+        options.optimizer = optimizer_options(request->optimizer());
+        options.workers = request->workers();
+        const std::string& parameters = request->parameters();
+        auto shard = std::make_shared<ParameterShard>(request->offset(), request->total_count(),
+                                                      reinterpret_cast<const float*>(parameters.data()),
+                                                      parameters.size() / sizeof(float), options);
+        parameter_store.init(request->model_id(), shard);
+        LEAF_LOG_INFO("InitParameterShard: Holding " << shard->size() << " of " << shard->get_total_count()
+                      << " parameters of " << request->model_id() << " from offset " << shard->get_offset()
+                      << " (" << optimizer_kind_name(options.optimizer.kind) << " on " << optimizer_isa() << ", "
+                      << options.workers << " workers per update)");
+        
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+Status ServerCommunicationServiceImpl::PushGradients(ServerContext* /*context*/, const PushGradientsRequest* request, PushGradientsResponse* response) {
+    static RpcMetrics rpc("PushGradients");
+    static Histogram& apply_us = metrics().histogram("ps.apply_us");
+    RpcScope<PushGradientsRequest, PushGradientsResponse> scope(rpc, *request, *response);
+    ServerLoad::Request in_flight(load);
+    try {
+        auto shard = parameter_store.get(request->model_id());
+        if (request->offset() != shard->get_offset()) {
+            throw std::invalid_argument("Gradients for offset " + std::to_string(request->offset()) +
+                                        " sent to the shard at offset " + std::to_string(shard->get_offset()));
+        }
+        const std::string& gradients = request->gradients();
+        bool applied = false;
+        uint64_t version;
+        {
+            ScopedTimer timer(apply_us);
+            version = shard->push(reinterpret_cast<const float*>(gradients.data()), gradients.size() / sizeof(float), &applied);
+        }
+        LEAF_LOG_TRACE("PushGradients: " << request->model_id() << " at version " << version
+                       << (applied ? " (applied)" : " (pending)"));
+        
+        response->set_version(version);
+        response->set_applied(applied);
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+Status ServerCommunicationServiceImpl::PullParameters(ServerContext* /*context*/, const PullParametersRequest* request, PullParametersResponse* response) {
+    static RpcMetrics rpc("PullParameters");
+    RpcScope<PullParametersRequest, PullParametersResponse> scope(rpc, *request, *response);
+    try {
+        auto shard = parameter_store.get(request->model_id());
+        // Bounded so a worker waiting for stragglers does not hold a gRPC thread indefinitely
+        auto wait = std::chrono::milliseconds(std::min<uint32_t>(request->wait_ms(), 60000));
+        uint64_t version = 0;
+        if (!shard->pull(request->min_version(), wait, response->mutable_parameters(), &version)) {
+            throw std::runtime_error("Timed out waiting for version " + std::to_string(request->min_version()) +
+                                     " of " + request->model_id() + " (at " + std::to_string(shard->get_version()) + ")");
+        }
+        response->set_offset(shard->get_offset());
+        response->set_total_count(shard->get_total_count());
+        response->set_version(version);
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+Status ServerCommunicationServiceImpl::StoreDataShard(ServerContext* /*context*/, const StoreDataShardRequest* request, StoreDataShardResponse* response) {
+    static RpcMetrics rpc("StoreDataShard");
+    RpcScope<StoreDataShardRequest, StoreDataShardResponse> scope(rpc, *request, *response);
+    ServerLoad::Request in_flight(load, false);
+    try {
+        if (role == ServerRole::ParameterServer) {
+            throw std::runtime_error("Server runs as a parameter server only");
+        }
+        size_t rows = data_shards.store(request->shard_id(), request->append(),
+                                        {request->input_shape().begin(), request->input_shape().end()},
+                                        request->inputs(),
+                                        {request->target_shape().begin(), request->target_shape().end()},
+                                        request->targets(), request->integer_targets());
+        LEAF_LOG_DEBUG("StoreDataShard: " << request->shard_id() << " holds " << rows << " rows");
+        
+        response->set_rows(rows);
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+Status ServerCommunicationServiceImpl::LocalTrain(ServerContext* /*context*/, const LocalTrainRequest* request, LocalTrainResponse* response) {
+    static RpcMetrics rpc("LocalTrain");
+    static Histogram& round_us = metrics().histogram("local_sgd.round_us");
+    RpcScope<LocalTrainRequest, LocalTrainResponse> scope(rpc, *request, *response);
+    ServerTraceSpan span(request->trace() ? response->mutable_trace_events() : nullptr, "LocalTrain", "server");
+    ServerLoad::Request in_flight(load);
+    try {
+        if (role == ServerRole::ParameterServer) {
+            throw std::runtime_error("Server runs as a parameter server only");
+        }
+        const std::string& model_id = request->model_id();
+        if (!stored_models.has_architecture(model_id)) {
+            throw std::runtime_error("Model " + model_id + " has no architecture on this server; register it first");
+        }
+        const std::string& weights = request->model_state();
+        if (weights.empty()) {
+            throw std::invalid_argument("LocalTrain needs the weights to start the round from");
+        }
+        OptimizerOptions options = optimizer_options(request->optimizer());
+        
+        std::lock_guard<std::mutex> lock(local_train_mutex);
+        // Copy-on-write if a checkpoint still references the current weights, so the steps below
+        // never modify a snapshot in place
+        stored_models.update_weights(model_id, reinterpret_cast<const float*>(weights.data()), weights.size() / sizeof(float));
+        auto model = get_model(model_id);
+        LocalOptimizerState& state = local_optimizers[model_id];
+        if (request->reset_optimizer() || state.optimizers.empty()) {
+            state.options = options;
+            state.optimizers.clear();
+        }
+        
+        LocalStepsResult result;
+        {
+            ServerTraceSpan steps(request->trace() ? response->mutable_trace_events() : nullptr, "local steps", "server");
+            ScopedTimer timer(round_us);
+            py::gil_scoped_acquire gil;
+            py::object criterion = load_module(request->criterion(), py::str("cpu"));
+            result = run_local_steps(model->get_pytorch_model(), criterion, state, data_shards, request->shard_id(),
+                                     request->steps(), request->batch_size(), request->seed());
+            std::vector<float> trained = model->serialize_state();
+            response->set_model_state(trained.data(), trained.size() * sizeof(float));
+        }
+        LEAF_LOG_DEBUG("LocalTrain: " << result.steps << " steps of " << model_id << " on "
+                       << request->shard_id() << ", mean loss " << (result.steps ? result.loss_sum / result.steps : 0.0));
+        mark_checkpoint_dirty();
+        
+        response->set_mean_loss(result.steps ? result.loss_sum / result.steps : 0.0);
+        response->set_samples(result.samples);
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+Status ServerCommunicationServiceImpl::ComputeGradients(ServerContext* /*context*/, const ComputeGradientsRequest* request, ComputeGradientsResponse* response) {
+    static RpcMetrics rpc("ComputeGradients");
+    static Histogram& backward_us = metrics().histogram("async_sgd.gradients_us");
+    RpcScope<ComputeGradientsRequest, ComputeGradientsResponse> scope(rpc, *request, *response);
+    ServerTraceSpan span(request->trace() ? response->mutable_trace_events() : nullptr, "ComputeGradients", "server");
+    ServerLoad::Request in_flight(load);
+    try {
+        if (role == ServerRole::ParameterServer) {
+            throw std::runtime_error("Server runs as a parameter server only");
+        }
+        const std::string& model_id = request->model_id();
+        if (!stored_models.has_architecture(model_id)) {
+            throw std::runtime_error("Model " + model_id + " has no architecture on this server; register it first");
+        }
+        
+        // StoreModelWeights waits for the gradients, so they belong to the version read here
+        std::lock_guard<std::mutex> lock(local_train_mutex);
+        uint64_t version = model_versions[model_id];
+        auto model = get_model(model_id);
+        LocalStepsResult result;
+        {
+            ServerTraceSpan backward(request->trace() ? response->mutable_trace_events() : nullptr, "backward", "server");
+            ScopedTimer timer(backward_us);
+            py::gil_scoped_acquire gil;
+            py::object criterion = load_module(request->criterion(), py::str("cpu"));
+            result = compute_batch_gradients(model->get_pytorch_model(), criterion, data_shards, request->shard_id(),
+                                             request->batch_size(), request->seed(), response->mutable_gradients());
+        }
+        
+        response->set_version(version);
+        response->set_loss(result.loss_sum);
+        response->set_samples(result.samples);
+        response->set_success(true);
+        response->set_error_message("");
+        return Status::OK;
+    } catch (const std::exception& e) {
+        response->set_success(false);
+        response->set_error_message(e.what());
+        return Status::OK;
+    }
+}
+
+size_t ServerCommunicationServiceImpl::take_outputs(const std::string& request_id, std::vector<CachedOutput>* outputs) {
+    return output_cache.take_request(request_id, outputs);
+}
+
+size_t ServerCommunicationServiceImpl::restore_checkpoint() {
+    if (checkpoint_path.empty() || access(checkpoint_path.c_str(), F_OK) != 0) {
+        return 0;
+    }
+    CheckpointFile checkpoint(checkpoint_path);
+    py::gil_scoped_acquire gil;
+    for (const auto& entry : checkpoint.get_entries()) {
+        // The architecture was saved on the meta device, so loading it allocates no weights
+        py::object module = load_module(checkpoint.architecture(entry), py::none());
+        stored_models.put_mapped(entry.model_id, std::make_shared<Model>(module, nullptr), checkpoint.get_mapping(),
+                                 checkpoint.weights(entry), entry.weights_count);
+    }
+    return checkpoint.get_entries().size();
+}
+
+size_t ServerCommunicationServiceImpl::save_checkpoint() {
+    if (checkpoint_path.empty()) {
+        throw std::runtime_error("Server was started without --checkpoint-dir");
+    }
+    // Local rounds step the stored weights in place, so a snapshot taken during one would mix
+    // weights from before and after its steps; like them, take the training lock before the GIL
+    std::lock_guard<std::mutex> training_lock(local_train_mutex);
+    {
+        std::lock_guard<std::mutex> lock(checkpoint_mutex);
+        checkpoint_dirty = false;
+    }
+    std::string dir = checkpoint_path.substr(0, checkpoint_path.find_last_of('/'));
+    if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST) {
+        throw std::runtime_error("Failed to create checkpoint directory " + dir);
+    }
+
+    CheckpointJob job;
+    job.path = checkpoint_path;
+    for (auto& snapshot : stored_models.snapshot()) {
+        job.tensors.push_back(std::move(snapshot.tensor));
+        job.keepalive.insert(job.keepalive.end(), snapshot.keepalive.begin(), snapshot.keepalive.end());
+    }
+    size_t model_count = job.tensors.size();
+    checkpoint_writer.submit(std::move(job));
+    return model_count;
+}
+
+void configure_server_builder(grpc::ServerBuilder& builder) {
     // Configure server with increased message size limits
     // Default is 4MB, we'll set it to 100MB to handle large model weights
     builder.AddChannelArgument(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, 100 * 1024 * 1024);  // 100MB
@@ -258,11 +745,161 @@ int main(int /*argc*/, char** /*argv*/) {
     builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
     builder.AddChannelArgument(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
     builder.AddChannelArgument(GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS, 5000);
+}
+
+// Benchmarks that host the service in their own process build with -DLEAF_SERVER_NO_MAIN
+#ifndef LEAF_SERVER_NO_MAIN
+
+static void print_usage(const char* program) {
+    std::cout << "Usage: " << program << " [--port N] [--bind ADDR] [--max-batch-size N] [--max-batch-delay-us N]"
+              << " [--output-cache-mb N] [--model-memory-mb N] [--spill-dir DIR]"
+              << " [--checkpoint-dir DIR] [--checkpoint-interval SECONDS] [--numa-node LIST] [--cpus LIST] [--intra-op-threads N]"
+              << " [--log-level LEVEL] [--role ROLE]" << std::endl;
+    std::cout << "  The port is unauthenticated and stored models and criteria are unpickled with torch.load," << std::endl;
+    std::cout << "  so anyone who can reach it can run code as the server. ADDR defaults to 127.0.0.1; trainers" << std::endl;
+    std::cout << "  reach remote servers through their SSH tunnel. Only bind other addresses (e.g. 0.0.0.0 in a" << std::endl;
+    std::cout << "  container published on the host's loopback) where every peer is trusted." << std::endl;
+    std::cout << "  Models changed since the last checkpoint are checkpointed every SECONDS (default 60)" << std::endl;
+    std::cout << "  and when SIGTERM or SIGINT stops the server; 0 only checkpoints when a trainer calls" << std::endl;
+    std::cout << "  SaveCheckpoint." << std::endl;
+    std::cout << "  LIST is a CPU or node list such as 0-15,32-47. Run one server per socket to keep" << std::endl;
+    std::cout << "  each server's threads and memory on one NUMA node." << std::endl;
+    std::cout << "  LEVEL is trace, debug, info, warn, error or off (default: $LEAF_LOG_LEVEL or info)." << std::endl;
+    std::cout << "  ROLE is worker (run models, the default), parameter-server (hold parameter shards and" << std::endl;
+    std::cout << "  apply pushed gradients) or both." << std::endl;
+}
+
+int main(int argc, char** argv) {
+    int port = 50051;
+    std::string bind_address = "127.0.0.1";
+    ServerOptions options;
+    PlacementOptions placement_options;
+    
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            print_usage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--port") {
+            port = std::stoi(value);
+        } else if (arg == "--bind") {
+            bind_address = value;
+        } else if (arg == "--max-batch-size") {
+            options.batching.max_batch_size = std::stoul(value);
+        } else if (arg == "--max-batch-delay-us") {
+            options.batching.max_delay = std::chrono::microseconds(std::stol(value));
+        } else if (arg == "--output-cache-mb") {
+            options.output_cache_bytes = std::stoull(value) * 1024 * 1024;
+        } else if (arg == "--model-memory-mb") {
+            options.model_store.memory_budget_bytes = std::stoull(value) * 1024 * 1024;
+        } else if (arg == "--spill-dir") {
+            options.model_store.spill_dir = value;
+        } else if (arg == "--checkpoint-dir") {
+            options.checkpoint_dir = value;
+        } else if (arg == "--checkpoint-interval") {
+            options.checkpoint_interval = std::chrono::seconds(std::stol(value));
+        } else if (arg == "--numa-node") {
+            placement_options.numa_nodes = parse_cpu_list(value);
+        } else if (arg == "--cpus") {
+            placement_options.cpus = parse_cpu_list(value);
+        } else if (arg == "--intra-op-threads") {
+            placement_options.intra_op_threads = std::stoi(value);
+        } else if (arg == "--log-level") {
+            try {
+                set_log_level(parse_log_level(value));
+            } catch (const std::invalid_argument& e) {
+                std::cerr << e.what() << std::endl;
+                return 1;
+            }
+        } else if (arg == "--role") {
+            if (value == "worker") {
+                options.role = ServerRole::Worker;
+            } else if (value == "parameter-server") {
+                options.role = ServerRole::ParameterServer;
+            } else if (value == "both") {
+                options.role = ServerRole::Both;
+            } else {
+                std::cerr << "Unknown role " << value << " (expected worker, parameter-server or both)" << std::endl;
+                return 1;
+            }
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
     
+    // SIGTERM (docker stop) and SIGINT shut the server down cleanly, so the service's final
+    // checkpoint and the writer's queue reach the disk. They are blocked here, before any thread
+    // starts, so every thread inherits the mask and only the sigwait thread below receives them.
+    sigset_t shutdown_signals;
+    sigemptyset(&shutdown_signals);
+    sigaddset(&shutdown_signals, SIGTERM);
+    sigaddset(&shutdown_signals, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &shutdown_signals, nullptr);
+    
+    // Placement must precede the interpreter and the gRPC server so that every thread they start
+    // inherits it. gRPC's sync server does not expose its pollers, so it is applied process-wide.
+    Placement placement;
+    bool placed = !placement_options.empty() || placement_options.intra_op_threads > 0;
+    if (placed) {
+        try {
+            placement = apply_placement(placement_options);
+            LEAF_LOG_INFO("Placed server on " << describe_placement(placement));
+        } catch (const std::exception& e) {
+            std::cerr << "Invalid placement: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    
+    // The service runs PyTorch models, so the server embeds an interpreter. gRPC worker threads
+    // acquire the GIL only while running a batch, so the main thread must not hold it while serving.
+    py::scoped_interpreter interpreter;
+    if (placed) {
+        py::module_::import("torch").attr("set_num_threads")(placement.intra_op_threads);
+    }
+    py::gil_scoped_release release;
+    
+    const std::string addr(bind_address + ":" + std::to_string(port));
+    ServerCommunicationServiceImpl service(options);
+    
+    // Restored models are only mapped here; their weights are read in on first use
+    try {
+        auto start = std::chrono::steady_clock::now();
+        size_t restored = service.restore_checkpoint();
+        if (restored > 0) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            LEAF_LOG_INFO("Restored " << restored << " models from checkpoint in " << elapsed.count() << "ms");
+        }
+    } catch (const std::exception& e) {
+        LEAF_LOG_WARN("Ignoring unreadable checkpoint: " << e.what());
+    }
+    
+    ServerBuilder builder;
+    configure_server_builder(builder);
     builder.AddListeningPort(addr, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    LEAF_LOG_INFO("Server listening on " << addr << " (max batch size " << options.batching.max_batch_size
+                  << ", max batch delay " << options.batching.max_delay.count() << "us)");
+    std::thread signal_thread([&server, &shutdown_signals] {
+        int signal_number = 0;
+        sigwait(&shutdown_signals, &signal_number);
+        LEAF_LOG_INFO("Received signal " << signal_number << ", shutting down");
+        // Heartbeat streams only end when cancelled, which Shutdown does once the deadline passes
+        server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(5));
+    });
     server->Wait();
+    signal_thread.join();
+    // Destroying the service writes the last checkpoint and waits for the writer
     return 0;
 }
 
+#endif // LEAF_SERVER_NO_MAIN
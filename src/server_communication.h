@@ -4,10 +4,21 @@
 #include <grpcpp/grpcpp.h>
 #include "server_communication.grpc.pb.h"
 #include "model.h"
+#include "forward_batcher.h"
+#include "output_cache.h"
+#include "model_store.h"
+#include "checkpoint_writer.h"
+#include "server_load.h"
+#include "parameter_server.h"
+#include "local_training.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
 
 using grpc::ServerContext;
 using grpc::Status;
@@ -20,30 +31,126 @@ using leaftest::GradientRequest;
 using leaftest::GradientResponse;
 using leaftest::StoreModelWeightsRequest;
 using leaftest::StoreModelWeightsResponse;
+using leaftest::SaveCheckpointRequest;
+using leaftest::SaveCheckpointResponse;
+using leaftest::ResourcesRequest;
+using leaftest::ResourcesResponse;
+using leaftest::HeartbeatRequest;
+using leaftest::HeartbeatResponse;
+using leaftest::MetricsRequest;
+using leaftest::MetricsResponse;
+using leaftest::InitShardRequest;
+using leaftest::InitShardResponse;
+using leaftest::PushGradientsRequest;
+using leaftest::PushGradientsResponse;
+using leaftest::PullParametersRequest;
+using leaftest::PullParametersResponse;
+using leaftest::StoreDataShardRequest;
+using leaftest::StoreDataShardResponse;
+using leaftest::LocalTrainRequest;
+using leaftest::LocalTrainResponse;
+using leaftest::ComputeGradientsRequest;
+using leaftest::ComputeGradientsResponse;
+
+// What a server does: run models for trainers, hold parameter shards, or both
+enum class ServerRole { Worker, ParameterServer, Both };
+
+struct ServerOptions {
+    BatchingOptions batching;
+    size_t output_cache_bytes = 256 * 1024 * 1024;  // Budget for outputs kept between forward and backward
+    ModelStoreOptions model_store;
+    std::string checkpoint_dir;  // Stored models are checkpointed here and restored on startup; empty disables
+    // How often models changed since the last checkpoint are checkpointed; 0 leaves it to SaveCheckpoint
+    std::chrono::seconds checkpoint_interval{60};
+    ServerRole role = ServerRole::Worker;
+};
 
 class ServerCommunicationServiceImpl final : public ServerCommunication::Service {
 private:
-    // Store actual Model objects on the server instead of just vectors of floats
-    std::map<std::string, std::shared_ptr<Model>> stored_models;
+    // Store actual Model objects on the server, spilling cold ones to disk past the memory budget
+    ModelStore stored_models;
+
+    // Coalesces concurrent ForwardPass calls for the same model into one forward
+    ForwardBatcher batcher;
+
+    // Outputs of forward passes that asked to be retained, keyed by request id
+    OutputCache output_cache;
+
+    // Requests in flight and recent step times, reported by Heartbeat
+    ServerLoad load;
+
+    // Parameter shards this server owns when it acts as a parameter server
+    ServerRole role;
+    ParameterStore parameter_store;
 
-    // NEW: Map to keep the most recent output tensor for each stored model
-    std::map<std::string, std::vector<float>> model_outputs;
+    // Training data and per-model optimizer state for local SGD rounds
+    DataShardStore data_shards;
+    // Serializes local rounds, gradient computations, weight stores and checkpoint snapshots, so
+    // gradients are computed on exactly the weights of the version they report and a checkpoint
+    // never catches a round halfway; guards local_optimizers and model_versions
+    std::mutex local_train_mutex;
+    std::map<std::string, LocalOptimizerState> local_optimizers;
+    // Version of each model's weights as last set by StoreModelWeights, for asynchronous SGD
+    std::map<std::string, uint64_t> model_versions;
+
+    // Checkpoint of the stored models, written in the background; declared last so pending
+    // checkpoints are written before the models they reference are destroyed
+    std::string checkpoint_path;
+    CheckpointWriter checkpoint_writer;
+
+    // Weight stores and local rounds only mark the models as changed; a background thread
+    // checkpoints them every checkpoint_interval, so frequent updates do not each snapshot them
+    std::chrono::seconds checkpoint_interval;
+    std::mutex checkpoint_mutex;
+    std::condition_variable checkpoint_cv;
+    bool checkpoint_dirty;
+    bool checkpoint_stopping;
+    std::thread checkpoint_thread;
+
+    void mark_checkpoint_dirty();
+    void run_periodic_checkpoints();
 
 public:
+    explicit ServerCommunicationServiceImpl(const ServerOptions& options = ServerOptions());
+    ~ServerCommunicationServiceImpl();
+
     Status GetServerTime(ServerContext* /*context*/, const TimeRequest* /*request*/, TimeResponse* response) override;
     Status ForwardPass(ServerContext* /*context*/, const ForwardPassRequest* request, ForwardPassResponse* response) override;
     Status GetGradients(ServerContext* /*context*/, const GradientRequest* request, GradientResponse* response) override;
     Status StoreModelWeights(ServerContext* /*context*/, const StoreModelWeightsRequest* request, StoreModelWeightsResponse* response) override;
+    Status SaveCheckpoint(ServerContext* /*context*/, const SaveCheckpointRequest* request, SaveCheckpointResponse* response) override;
+    Status GetResources(ServerContext* /*context*/, const ResourcesRequest* /*request*/, ResourcesResponse* response) override;
+    Status Heartbeat(ServerContext* context, const HeartbeatRequest* request, grpc::ServerWriter<HeartbeatResponse>* writer) override;
+    Status GetMetrics(ServerContext* /*context*/, const MetricsRequest* /*request*/, MetricsResponse* response) override;
+    Status InitParameterShard(ServerContext* /*context*/, const InitShardRequest* request, InitShardResponse* response) override;
+    Status PushGradients(ServerContext* /*context*/, const PushGradientsRequest* request, PushGradientsResponse* response) override;
+    Status PullParameters(ServerContext* /*context*/, const PullParametersRequest* request, PullParametersResponse* response) override;
+    Status StoreDataShard(ServerContext* /*context*/, const StoreDataShardRequest* request, StoreDataShardResponse* response) override;
+    Status LocalTrain(ServerContext* /*context*/, const LocalTrainRequest* request, LocalTrainResponse* response) override;
+    Status ComputeGradients(ServerContext* /*context*/, const ComputeGradientsRequest* request, ComputeGradientsResponse* response) override;
     
     // Helper methods for model management
     bool has_model(const std::string& model_id) const;
-    std::shared_ptr<Model> get_model(const std::string& model_id) const;
+    std::shared_ptr<Model> get_model(const std::string& model_id);
     void store_model(const std::string& model_id, std::shared_ptr<Model> model);
     void remove_model(const std::string& model_id);
     std::vector<std::string> get_stored_model_ids() const;
 
-    // NEW: Store the latest outputs produced by each model after a forward pass
-    std::vector<float> get_outputs(const std::string& model_id) const;
+    // Remove and return the retained outputs of a forward request, one per chunk it was sent in
+    size_t take_outputs(const std::string& request_id, std::vector<CachedOutput>* outputs);
+
+    // Map the checkpoint and register its models, whose weights load on first use; returns the
+    // number restored (0 without a checkpoint). Throws std::runtime_error if it is unreadable.
+    size_t restore_checkpoint();
+
+    // Snapshot every stored model and queue the checkpoint for the background writer; returns the
+    // number of models in it. Throws std::runtime_error if checkpointing is not configured.
+    // Waits for a running local round or gradient computation. Marks the models as checkpointed,
+    // so the periodic checkpoint skips them until they change.
+    size_t save_checkpoint();
 };
 
+// Message size limits and keepalive settings the server listens with
+void configure_server_builder(grpc::ServerBuilder& builder);
+
 #endif // SERVER_COMMUNICATION_H 
\ No newline at end of file
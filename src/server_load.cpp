@@ -0,0 +1,57 @@
+#include "server_load.h"
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+ServerLoad::ServerLoad(size_t step_history) : in_flight(0), completed(0), history(step_history) {}
+
+ServerLoad::Request::Request(ServerLoad& server_load, bool record_time)
+    : load(server_load), start(std::chrono::steady_clock::now()), timed(record_time) {
+    load.in_flight.fetch_add(1, std::memory_order_relaxed);
+}
+
+ServerLoad::Request::~Request() {
+    load.in_flight.fetch_sub(1, std::memory_order_relaxed);
+    load.completed.fetch_add(1, std::memory_order_relaxed);
+    if (!timed) {
+        return;
+    }
+    float elapsed_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::lock_guard<std::mutex> lock(load.mutex);
+    load.recent_ms.push_back(elapsed_ms);
+    if (load.recent_ms.size() > load.history) {
+        load.recent_ms.pop_front();
+    }
+}
+
+std::vector<float> ServerLoad::recent_step_times_ms() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::vector<float>(recent_ms.begin(), recent_ms.end());
+}
+
+ProcessUsage read_process_usage() {
+    ProcessUsage usage;
+    rusage self{};
+    if (getrusage(RUSAGE_SELF, &self) == 0) {
+        usage.cpu_seconds = self.ru_utime.tv_sec + self.ru_utime.tv_usec / 1e6 +
+                            self.ru_stime.tv_sec + self.ru_stime.tv_usec / 1e6;
+    }
+#ifdef __APPLE__
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        usage.rss_bytes = info.resident_size;
+    }
+#else
+    // Second field of statm is the resident set in pages; ru_maxrss would only give the peak
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size_pages = 0, resident_pages = 0;
+    if (statm >> size_pages >> resident_pages) {
+        usage.rss_bytes = resident_pages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return usage;
+}
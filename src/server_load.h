@@ -0,0 +1,52 @@
+#ifndef SERVER_LOAD_H
+#define SERVER_LOAD_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// Tracks the requests a server is working on and how long its recent steps took, for heartbeats
+class ServerLoad {
+private:
+    std::atomic<uint32_t> in_flight;
+    std::atomic<uint64_t> completed;
+    size_t history;
+    mutable std::mutex mutex;
+    std::deque<float> recent_ms;  // Newest at the back
+
+public:
+    explicit ServerLoad(size_t step_history = 32);
+
+    // Counts a request as in flight for its lifetime; timed requests also record their duration
+    // as a step time
+    class Request {
+    private:
+        ServerLoad& load;
+        std::chrono::steady_clock::time_point start;
+        bool timed;
+
+    public:
+        explicit Request(ServerLoad& server_load, bool record_time = true);
+        ~Request();
+        Request(const Request&) = delete;
+        Request& operator=(const Request&) = delete;
+    };
+
+    uint32_t get_in_flight() const { return in_flight.load(std::memory_order_relaxed); }
+    uint64_t get_completed() const { return completed.load(std::memory_order_relaxed); }
+    std::vector<float> recent_step_times_ms() const;
+};
+
+struct ProcessUsage {
+    double cpu_seconds = 0.0;  // User plus system time of all threads
+    uint64_t rss_bytes = 0;
+};
+
+// CPU time and resident set size of the calling process
+ProcessUsage read_process_usage();
+
+#endif // SERVER_LOAD_H
@@ -0,0 +1,45 @@
+#include "tensor_buffer.h"
+#include <stdexcept>
+
+namespace py = pybind11;
+
+static std::vector<py::ssize_t> resolve_shape(const std::vector<py::ssize_t>& shape, size_t num_floats) {
+    if (shape.empty()) {
+        return {static_cast<py::ssize_t>(num_floats)};
+    }
+    size_t expected = 1;
+    for (py::ssize_t dim : shape) {
+        expected *= static_cast<size_t>(dim);
+    }
+    if (expected != num_floats) {
+        throw std::runtime_error("Shape does not match payload: expected " + std::to_string(expected) +
+                                 " elements, got " + std::to_string(num_floats));
+    }
+    return shape;
+}
+
+py::array_t<float> wrap_message_floats(std::unique_ptr<google::protobuf::Message> owner,
+                                       std::string* payload,
+                                       const std::vector<py::ssize_t>& shape) {
+    // Trailing bytes that do not make up a whole float are ignored
+    size_t num_floats = payload->size() / sizeof(float);
+    std::vector<py::ssize_t> dims = resolve_shape(shape, num_floats);
+    float* data = reinterpret_cast<float*>(payload->data());
+
+    // The capsule becomes the array's base object and deletes the message with the last reference
+    google::protobuf::Message* raw_owner = owner.release();
+    py::capsule base(raw_owner, [](void* ptr) {
+        delete static_cast<google::protobuf::Message*>(ptr);
+    });
+    return py::array_t<float>(dims, data, base);
+}
+
+py::array_t<float> wrap_vector_floats(std::vector<float>&& values,
+                                      const std::vector<py::ssize_t>& shape) {
+    std::vector<py::ssize_t> dims = resolve_shape(shape, values.size());
+    auto* owner = new std::vector<float>(std::move(values));
+    py::capsule base(owner, [](void* ptr) {
+        delete static_cast<std::vector<float>*>(ptr);
+    });
+    return py::array_t<float>(dims, owner->data(), base);
+}
@@ -0,0 +1,24 @@
+#ifndef TENSOR_BUFFER_H
+#define TENSOR_BUFFER_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <google/protobuf/message.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace py = pybind11;
+
+// Expose a float32 payload stored in a protobuf bytes field as a numpy array without copying.
+// The array owns the message through a capsule, so the payload stays valid for as long as the
+// array (or a torch.from_numpy view of it) is alive. An empty shape means a flat 1-D array.
+py::array_t<float> wrap_message_floats(std::unique_ptr<google::protobuf::Message> owner,
+                                       std::string* payload,
+                                       const std::vector<py::ssize_t>& shape = {});
+
+// Expose a float vector as a numpy array without copying; the array takes ownership of the vector.
+py::array_t<float> wrap_vector_floats(std::vector<float>&& values,
+                                      const std::vector<py::ssize_t>& shape = {});
+
+#endif // TENSOR_BUFFER_H
@@ -0,0 +1,211 @@
+#include "trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unistd.h>
+
+int64_t trace_now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+uint32_t trace_thread_id() {
+    static std::atomic<uint32_t> next_thread{1};
+    thread_local const uint32_t id = next_thread.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void Tracer::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    events.clear();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+static std::string json_escape(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", c);
+                    escaped += code;
+                } else {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
+size_t Tracer::stop(const std::string& path) {
+    std::vector<TraceSpanEvent> recorded;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        enabled.store(false, std::memory_order_relaxed);
+        recorded.swap(events);
+    }
+
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Cannot write trace to " + path);
+    }
+    // The trainer is process 0 and each server that returned spans gets a process of its own
+    std::map<std::string, int> server_pids;
+    for (const auto& event : recorded) {
+        if (event.remote && !server_pids.count(event.server)) {
+            int pid = static_cast<int>(server_pids.size()) + 1;
+            server_pids[event.server] = pid;
+        }
+    }
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"trainer (pid " << getpid() << ")\"}}";
+    for (const auto& [server, pid] : server_pids) {
+        out << ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+            << ",\"args\":{\"name\":\"server " << json_escape(server) << "\"}}";
+    }
+    for (const auto& event : recorded) {
+        int pid = event.remote ? server_pids[event.server] : 0;
+        out << ",\n{\"name\":\"" << json_escape(event.name) << "\",\"cat\":\"" << json_escape(event.category)
+            << "\",\"ph\":\"X\",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us
+            << ",\"pid\":" << pid << ",\"tid\":" << event.thread_id << ",\"args\":{\"step\":" << event.step;
+        if (!event.server.empty()) {
+            out << ",\"server\":\"" << json_escape(event.server) << "\"";
+        }
+        out << "}}";
+    }
+    out << "\n]}\n";
+    if (!out) {
+        throw std::runtime_error("Failed writing trace to " + path);
+    }
+    return recorded.size();
+}
+
+void Tracer::record(TraceSpanEvent event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (enabled.load(std::memory_order_relaxed)) {
+        events.push_back(std::move(event));
+    }
+}
+
+void Tracer::record_rpc(const char* method, const std::string& server, int64_t start_us, int64_t end_us,
+                        const google::protobuf::RepeatedPtrField<leaftest::TraceEvent>& server_events) {
+    if (!is_enabled()) {
+        return;
+    }
+    int64_t current_step = get_step();
+    TraceSpanEvent rpc;
+    rpc.name = method;
+    rpc.category = "rpc";
+    rpc.server = server;
+    rpc.step = current_step;
+    rpc.start_us = start_us;
+    rpc.duration_us = end_us - start_us;
+    rpc.thread_id = trace_thread_id();
+    record(std::move(rpc));
+    if (server_events.empty()) {
+        return;
+    }
+
+    int64_t first = std::numeric_limits<int64_t>::max();
+    int64_t last = std::numeric_limits<int64_t>::min();
+    for (const auto& event : server_events) {
+        first = std::min(first, event.start_us());
+        last = std::max(last, event.start_us() + event.duration_us());
+    }
+    int64_t offset = (start_us + end_us) / 2 - (first + last) / 2;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    for (const auto& event : server_events) {
+        TraceSpanEvent span;
+        span.name = event.name();
+        span.category = event.category();
+        span.server = server;
+        span.remote = true;
+        span.step = current_step;
+        span.start_us = event.start_us() + offset;
+        span.duration_us = event.duration_us();
+        span.thread_id = event.thread_id();
+        events.push_back(std::move(span));
+    }
+}
+
+Tracer& tracer() {
+    static Tracer* instance = new Tracer();
+    return *instance;
+}
+
+TraceSpan::TraceSpan(const char* span_name, const char* span_category, std::string server_name)
+    : name(span_name), category(span_category), server(std::move(server_name)),
+      start_us(tracer().is_enabled() ? trace_now_us() : -1) {}
+
+void TraceSpan::finish() {
+    if (start_us < 0) {
+        return;
+    }
+    TraceSpanEvent event;
+    event.name = name;
+    event.category = category;
+    event.server = std::move(server);
+    event.step = tracer().get_step();
+    event.start_us = start_us;
+    event.duration_us = trace_now_us() - start_us;
+    event.thread_id = trace_thread_id();
+    start_us = -1;
+    tracer().record(std::move(event));
+}
+
+TraceScope::TraceScope(std::string span_name, std::string span_category)
+    : name(std::move(span_name)), category(std::move(span_category)) {}
+
+void TraceScope::enter() {
+    start_us = tracer().is_enabled() ? trace_now_us() : -1;
+}
+
+void TraceScope::exit() {
+    if (start_us < 0) {
+        return;
+    }
+    TraceSpanEvent event;
+    event.name = name;
+    event.category = category;
+    event.step = tracer().get_step();
+    event.start_us = start_us;
+    event.duration_us = trace_now_us() - start_us;
+    event.thread_id = trace_thread_id();
+    start_us = -1;
+    tracer().record(std::move(event));
+}
+
+void add_trace_event(google::protobuf::RepeatedPtrField<leaftest::TraceEvent>* events,
+                     const char* name, const char* category, int64_t start_us, int64_t end_us) {
+    leaftest::TraceEvent* event = events->Add();
+    event->set_name(name);
+    event->set_category(category);
+    event->set_start_us(start_us);
+    event->set_duration_us(end_us - start_us);
+    event->set_thread_id(trace_thread_id());
+}
+
+ServerTraceSpan::ServerTraceSpan(google::protobuf::RepeatedPtrField<leaftest::TraceEvent>* trace_events,
+                                 const char* span_name, const char* span_category)
+    : events(trace_events), name(span_name), category(span_category),
+      start_us(trace_events ? trace_now_us() : 0) {}
+
+ServerTraceSpan::~ServerTraceSpan() {
+    if (events) {
+        add_trace_event(events, name, category, start_us, trace_now_us());
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <google/protobuf/repeated_field.h>
+#include "server_communication.pb.h"
+
+// Wall clock in microseconds since the epoch, the time base of every span
+int64_t trace_now_us();
+
+// Small per-thread id for the "tid" of trace events
+uint32_t trace_thread_id();
+
+// A completed span. server is empty for the trainer's own work; spans of the trainer's RPCs carry
+// the server they went to, and spans a server sent back are shown under that server's process.
+struct TraceSpanEvent {
+    std::string name;
+    std::string category;
+    std::string server;
+    bool remote = false;
+    int64_t step = 0;
+    int64_t start_us = 0;
+    int64_t duration_us = 0;
+    uint32_t thread_id = 0;
+};
+
+// Collects spans while tracing is on and writes them as Chrome trace_event JSON (chrome://tracing,
+// Perfetto). With tracing off, a span costs one relaxed atomic load.
+class Tracer {
+private:
+    std::atomic<bool> enabled{false};
+    std::atomic<int64_t> step{0};
+    mutable std::mutex mutex;
+    std::vector<TraceSpanEvent> events;
+
+public:
+    // Discard earlier spans and start recording
+    void start();
+    // Stop recording and write the spans to path; returns the number written.
+    // Throws std::runtime_error if the file cannot be written.
+    size_t stop(const std::string& path);
+    bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    // Training step that new spans are attributed to
+    void set_step(int64_t value) { step.store(value, std::memory_order_relaxed); }
+    int64_t get_step() const { return step.load(std::memory_order_relaxed); }
+
+    void record(TraceSpanEvent event);
+
+    // Record an RPC to server that ran from start_us to end_us on our clock, along with the spans
+    // the server returned for it. Server clocks are not synchronized with ours, so the server's
+    // spans are shifted to sit centered inside the RPC, splitting network time evenly both ways.
+    void record_rpc(const char* method, const std::string& server, int64_t start_us, int64_t end_us,
+                    const google::protobuf::RepeatedPtrField<leaftest::TraceEvent>& server_events);
+};
+
+// Process-wide tracer
+Tracer& tracer();
+
+// Records a span of the current scope while tracing is on
+class TraceSpan {
+private:
+    const char* name;
+    const char* category;
+    std::string server;
+    int64_t start_us;  // -1 when tracing was off at construction
+
+public:
+    TraceSpan(const char* span_name, const char* span_category, std::string server_name = "");
+    ~TraceSpan() { finish(); }
+    // End the span before the scope does
+    void finish();
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+// A span whose bounds are set explicitly, for phases run from Python (batch fetch, gradient
+// reduction, the optimizer step) through a `with trainer.trace_span(name):` block
+class TraceScope {
+private:
+    std::string name;
+    std::string category;
+    int64_t start_us = -1;
+
+public:
+    TraceScope(std::string span_name, std::string span_category);
+    void enter();
+    void exit();
+};
+
+// Server side: records a span into a response's trace_events when the request asked for a trace
+// (events is null otherwise)
+class ServerTraceSpan {
+private:
+    google::protobuf::RepeatedPtrField<leaftest::TraceEvent>* events;
+    const char* name;
+    const char* category;
+    int64_t start_us;
+
+public:
+    ServerTraceSpan(google::protobuf::RepeatedPtrField<leaftest::TraceEvent>* trace_events,
+                    const char* span_name, const char* span_category);
+    ~ServerTraceSpan();
+    ServerTraceSpan(const ServerTraceSpan&) = delete;
+    ServerTraceSpan& operator=(const ServerTraceSpan&) = delete;
+};
+
+void add_trace_event(google::protobuf::RepeatedPtrField<leaftest::TraceEvent>* events,
+                     const char* name, const char* category, int64_t start_us, int64_t end_us);
+
+#endif // TRACE_H
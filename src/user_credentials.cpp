@@ -1,32 +1,123 @@
 #include "user_credentials.h"
+#include "logging.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <cerrno>
+#include <cstring>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
 
 // Static member definitions
 std::set<int> UserCredentials::used_ports;
 std::mutex UserCredentials::port_mutex;
 
-int UserCredentials::find_available_port() {
-    std::lock_guard<std::mutex> lock(port_mutex);
-    int start_port = 50051;
-    int max_port = 50100; // Allow up to 50 ports
-    
-    for (int port = start_port; port <= max_port; port++) {
-        if (used_ports.find(port) == used_ports.end()) {
-            // Check if port is actually available
-            std::string check_cmd = "lsof -Pi :" + std::to_string(port) + " -sTCP:LISTEN -t 2>/dev/null";
-            std::array<char, 128> buffer;
-            std::string result;
-            std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(check_cmd.c_str(), "r"), pclose);
-            
-            if (pipe) {
-                while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
-                    result += buffer.data();
-                }
+// Everything the server image is built from, relative to the repository root
+static const std::vector<std::string> server_build_files = {
+    "Dockerfile", "docker-run.sh",
+    "src/model.h", "src/model.cpp",
+    "src/forward_batcher.h", "src/forward_batcher.cpp",
+    "src/output_cache.h", "src/output_cache.cpp",
+    "src/model_store.h", "src/model_store.cpp",
+    "src/mapped_file.h", "src/mapped_file.cpp",
+    "src/checkpoint.h", "src/checkpoint.cpp",
+    "src/checkpoint_writer.h", "src/checkpoint_writer.cpp",
+    "src/resource_probe.h", "src/resource_probe.cpp",
+    "src/numa_placement.h", "src/numa_placement.cpp",
+    "src/server_load.h", "src/server_load.cpp",
+    "src/metrics.h", "src/metrics.cpp",
+    "src/logging.h", "src/logging.cpp",
+    "src/trace.h", "src/trace.cpp",
+    "src/parameter_server.h", "src/parameter_server.cpp",
+    "src/flat_optimizer.h", "src/flat_optimizer.cpp",
+    "src/local_training.h", "src/local_training.cpp",
+    "src/criterion.h", "src/criterion.cpp",
+    "src/server_communication.cpp", "src/server_communication.h", "src/server_communication.proto",
+};
+
+std::string UserCredentials::server_image_tag() {
+    static std::once_flag once;
+    static std::string tag;
+    std::call_once(once, [] {
+        // 64-bit FNV-1a over each file's name and contents; collisions only cost a stale image
+        uint64_t hash = 14695981039346656037ULL;
+        auto mix = [&hash](const char* data, size_t size) {
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= static_cast<unsigned char>(data[i]);
+                hash *= 1099511628211ULL;
             }
-            
-            if (result.empty()) {
-                used_ports.insert(port);
-                return port;
+        };
+        for (const auto& file : server_build_files) {
+            std::ifstream in(file, std::ios::binary);
+            if (!in) {
+                LEAF_LOG_WARN("Cannot read " << file << " to compute the image tag; images will always be rebuilt");
+                tag.clear();
+                return;
             }
+            std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            mix(file.c_str(), file.size() + 1);
+            uint64_t size = contents.size();
+            mix(reinterpret_cast<const char*>(&size), sizeof(size));
+            mix(contents.data(), contents.size());
+        }
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+        tag = hex;
+    });
+    return tag;
+}
+
+// Ask the kernel for a free loopback port by binding to port 0; returns 0 on failure
+static int probe_free_port() {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return 0;
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t len = sizeof(addr);
+    int port = 0;
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0 &&
+        getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) == 0) {
+        port = ntohs(addr.sin_port);
+    }
+    close(fd);
+    return port;
+}
+
+// True once something accepts connections on the loopback port
+static bool port_accepts_connections(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    bool connected = connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    close(fd);
+    return connected;
+}
+
+int UserCredentials::find_available_port() {
+    std::lock_guard<std::mutex> lock(port_mutex);
+    // The kernel hands out ports from its whole ephemeral range, so there is no fixed cap on
+    // tunnels; used_ports only guards against handing a port to two tunnels of this process
+    // before their ssh has bound it
+    for (int attempt = 0; attempt < 64; ++attempt) {
+        int port = probe_free_port();
+        if (port > 0 && used_ports.find(port) == used_ports.end()) {
+            used_ports.insert(port);
+            return port;
         }
     }
     throw std::runtime_error("No available ports for SSH tunnel");
@@ -41,122 +132,146 @@ void UserCredentials::release_port() {
 }
 
 bool UserCredentials::setup_ssh_tunnel() {
-    // Find an available port for this tunnel
-    try {
-        tunnel_port = find_available_port();
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to find available port: " << e.what() << std::endl;
-        return false;
-    }
-    
-    // Check if tunnel is already running on this port
-    std::string check_cmd = "lsof -Pi :" + std::to_string(tunnel_port) + " -sTCP:LISTEN -t 2>/dev/null";
-    std::array<char, 128> buffer;
-    std::string result;
-    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(check_cmd.c_str(), "r"), pclose);
-    
-    if (pipe) {
-        while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
-            result += buffer.data();
+    // Another process can take a probed port before ssh binds it; ExitOnForwardFailure makes ssh
+    // exit in that case, and we retry with a fresh port
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        // Find an available port for this tunnel
+        try {
+            tunnel_port = find_available_port();
+        } catch (const std::exception& e) {
+            LEAF_LOG_ERROR("Failed to find available port: " << e.what());
+            return false;
         }
-    }
-    
-    if (!result.empty()) {
-        std::cout << "Port " << tunnel_port << " is already in use. Killing existing tunnel..." << std::endl;
-        std::string kill_cmd = "pkill -f 'ssh.*" + std::to_string(tunnel_port) + ":localhost'";
-        std::system(kill_cmd.c_str());
-        std::this_thread::sleep_for(std::chrono::seconds(2));
-    }
-    
-    // Build SSH tunnel command with dynamic port
-    std::string ssh_cmd = "ssh -L " + std::to_string(tunnel_port) + ":localhost:50051 ";
-    if (!key_path.empty()) {
-        ssh_cmd += "-i " + key_path + " ";
-    }
-    ssh_cmd += "-p " + std::to_string(port) + " ";
-    ssh_cmd += username + "@" + hostname + " -N";
-            
-    // Start tunnel in background
-    ssh_cmd += " &";
-    int result_code = std::system(ssh_cmd.c_str());
-    
-    if (result_code != 0) {
-        std::cerr << "Failed to start SSH tunnel on port " << tunnel_port << std::endl;
-        release_port();
-        return false;
-    }
-    
-    // Wait for tunnel to establish
-    std::this_thread::sleep_for(std::chrono::seconds(3));
-    
-    // Verify tunnel is working
-    std::string verify_cmd = "lsof -Pi :" + std::to_string(tunnel_port) + " -sTCP:LISTEN -t 2>/dev/null";
-    result.clear();
-    pipe = std::unique_ptr<FILE, decltype(&pclose)>(popen(verify_cmd.c_str(), "r"), pclose);
-    
-    if (pipe) {
-        while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
-            result += buffer.data();
+        
+        // Build the argument vector before forking; the child only calls exec
+        std::vector<std::string> args = {
+            "ssh", "-N",
+            "-o", "BatchMode=yes",
+            "-o", "StrictHostKeyChecking=no",
+            "-o", "ExitOnForwardFailure=yes",
+            "-o", "ServerAliveInterval=30",
+            "-L", std::to_string(tunnel_port) + ":localhost:50051",
+            "-p", std::to_string(port),
+        };
+        if (!key_path.empty()) {
+            args.push_back("-i");
+            args.push_back(key_path);
         }
-    }
-    
-    if (!result.empty()) {
-        // Extract PID from result
-        std::string pid_str = result;
-        if (pid_str.find('\n') != std::string::npos) {
-            pid_str = pid_str.substr(0, pid_str.find('\n'));
+        args.push_back(username + "@" + hostname);
+        std::vector<char*> argv;
+        for (auto& arg : args) {
+            argv.push_back(&arg[0]);
         }
-        try {
-            tunnel_pid = std::stoi(pid_str);
-            std::cout << "SSH tunnel established on port " << tunnel_port << " (PID: " << tunnel_pid << ")" << std::endl;
-            return true;
-        } catch (const std::exception& e) {
-            std::cerr << "Failed to parse tunnel PID: " << e.what() << std::endl;
+        argv.push_back(nullptr);
+        
+        pid_t pid = fork();
+        if (pid < 0) {
+            LEAF_LOG_ERROR("Failed to start SSH tunnel on port " << tunnel_port << ": " << std::strerror(errno));
             release_port();
             return false;
         }
-    } else {
-        std::cerr << "SSH tunnel verification failed on port " << tunnel_port << std::endl;
+        if (pid == 0) {
+            int devnull = open("/dev/null", O_RDONLY);
+            if (devnull >= 0) {
+                dup2(devnull, STDIN_FILENO);
+            }
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
+        
+        // Wait until the forward accepts connections, or ssh gives up
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(15);
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (port_accepts_connections(tunnel_port)) {
+                tunnel_pid = pid;
+                LEAF_LOG_INFO("SSH tunnel established on port " << tunnel_port << " (PID: " << tunnel_pid << ")");
+                return true;
+            }
+            int status = 0;
+            if (waitpid(pid, &status, WNOHANG) == pid) {
+                pid = 0;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        if (pid > 0) {
+            kill(pid, SIGTERM);
+            waitpid(pid, nullptr, 0);
+        }
+        LEAF_LOG_ERROR("SSH tunnel verification failed on port " << tunnel_port);
         release_port();
-        return false;
     }
+    return false;
 }
 
 void UserCredentials::cleanup_ssh_tunnel() {
     if (tunnel_pid > 0) {
-        std::cout << "Cleaning up SSH tunnel (PID: " << tunnel_pid << ") on port " << tunnel_port << "..." << std::endl;
-        std::string kill_cmd = "kill " + std::to_string(tunnel_pid);
-        std::system(kill_cmd.c_str());
+        LEAF_LOG_INFO("Cleaning up SSH tunnel (PID: " << tunnel_pid << ") on port " << tunnel_port << "...");
+        kill(tunnel_pid, SIGTERM);
+        // The tunnel is our child, so reap it
+        waitpid(tunnel_pid, nullptr, 0);
         tunnel_pid = 0;
     }
     release_port();
 }
 
-bool UserCredentials::verify_ssh_connection() {
-    std::string test_ssh_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
+std::string UserCredentials::ssh_options(const std::string& control_master) const {
+    std::string options = "-o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
+    options += "-o ControlMaster=" + control_master + " -o ControlPath=" + control_path + " ";
     if (!key_path.empty()) {
-        test_ssh_cmd += "-i " + key_path + " ";
+        options += "-i " + key_path + " ";
     }
-    test_ssh_cmd += "-p " + std::to_string(port) + " ";
-    test_ssh_cmd += username + "@" + hostname + " 'echo SSH connection test successful'";
+    return options;
+}
+
+std::string UserCredentials::ssh_command(const std::string& remote_command) const {
+    // With ControlMaster=no, ssh multiplexes over the master when its socket exists and otherwise
+    // falls back to a connection of its own
+    return "ssh " + ssh_options() + "-p " + std::to_string(port) + " " + username + "@" + hostname +
+           " '" + remote_command + "'";
+}
+
+bool UserCredentials::start_control_master() {
+    // -f backgrounds ssh once it has authenticated, so the socket is ready when this returns.
+    // ControlPersist keeps the master between commands, and retires one leaked by a crashed
+    // process after ten idle minutes.
+    std::string master_cmd = "ssh -M -N -f -o ControlPersist=10m -o ServerAliveInterval=30 " + ssh_options("yes");
+    master_cmd += "-p " + std::to_string(port) + " " + username + "@" + hostname + " < /dev/null > /dev/null 2>&1";
+    control_master_open = std::system(master_cmd.c_str()) == 0;
+    if (!control_master_open) {
+        LEAF_LOG_WARN("Could not open a shared SSH connection to " << hostname
+                      << "; each command will connect separately");
+    }
+    return control_master_open;
+}
+
+void UserCredentials::close_control_master() {
+    if (!control_master_open) {
+        return;
+    }
+    std::string exit_cmd = "ssh -o ControlPath=" + control_path + " -O exit -p " + std::to_string(port) + " " +
+                           username + "@" + hostname + " > /dev/null 2>&1";
+    std::system(exit_cmd.c_str());
+    control_master_open = false;
+}
+
+bool UserCredentials::verify_ssh_connection() {
+    // Every later provisioning step and resource probe runs over this connection
+    start_control_master();
+    std::string test_ssh_cmd = ssh_command("echo SSH connection test successful");
     if (std::system(test_ssh_cmd.c_str()) != 0) {
-        std::cerr << "SSH connection test failed. Please verify:" << std::endl;
-        std::cerr << "1. SSH port " << port << " is correct" << std::endl;
-        std::cerr << "2. Username " << username << " is correct" << std::endl;
-        std::cerr << "3. SSH key is properly set up" << std::endl;
+        LEAF_LOG_ERROR("SSH connection test failed. Please verify:\n"
+                       << "1. SSH port " << port << " is correct\n"
+                       << "2. Username " << username << " is correct\n"
+                       << "3. SSH key is properly set up");
         return false;
     }
     return true;
 }
 
 bool UserCredentials::verify_remote_docker_installation() {
-    std::string check_docker_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        check_docker_cmd += "-i " + key_path + " ";
-    }
-    check_docker_cmd += "-p " + std::to_string(port) + " ";
-    check_docker_cmd += username + "@" + hostname + " 'which docker || echo \"DOCKER_NOT_FOUND\"'";
-    std::cout << "Checking for Docker installation..." << std::endl;
+    std::string check_docker_cmd = ssh_command("which docker || echo \"DOCKER_NOT_FOUND\"");
+    LEAF_LOG_INFO("Checking for Docker installation...");
     std::array<char, 128> buffer;
     std::string result;
     std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(check_docker_cmd.c_str(), "r"), pclose);
@@ -173,13 +288,8 @@ bool UserCredentials::verify_remote_docker_installation() {
 }
 
 bool UserCredentials::install_remote_docker() {
-    std::cout << "Docker not found. Installing Docker..." << std::endl;   
-    std::string install_docker_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        install_docker_cmd += "-i " + key_path + " ";
-    }
-    install_docker_cmd += "-p " + std::to_string(port) + " ";
-    install_docker_cmd += username + "@" + hostname + " '"
+    LEAF_LOG_INFO("Docker not found. Installing Docker...");
+    std::string install_docker_cmd = ssh_command(
         "echo \"Updating package lists...\" && "
         "sudo apt-get update && "
         "echo \"Installing prerequisites...\" && "
@@ -192,25 +302,20 @@ bool UserCredentials::install_remote_docker() {
         "echo \"Installing Docker...\" && "
         "sudo apt-get update && "
         "sudo apt-get install -y docker-ce docker-ce-cli containerd.io docker-buildx-plugin docker-compose-plugin && "
-        "echo \"Docker installation complete\"'";
-    std::cout << "Running Docker installation command..." << std::endl;
+        "echo \"Docker installation complete\"");
+    LEAF_LOG_INFO("Running Docker installation command...");
     if (std::system(install_docker_cmd.c_str()) != 0) {
-        std::cerr << "Failed to install Docker on " << hostname << std::endl;
+        LEAF_LOG_ERROR("Failed to install Docker on " << hostname);
         return false;
     }
-    std::cout << "Docker installed successfully" << std::endl;
+    LEAF_LOG_INFO("Docker installed successfully");
     return true;
 }
 
 std::string UserCredentials::verify_remote_docker_daemon_status() {
     std::string result;
     // Check if Docker daemon is running and start it if needed
-    std::string check_daemon_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        check_daemon_cmd += "-i " + key_path + " ";
-    }
-    check_daemon_cmd += "-p " + std::to_string(port) + " ";
-    check_daemon_cmd += username + "@" + hostname + " 'sudo systemctl is-active docker || echo \"DOCKER_NOT_RUNNING\"'";
+    std::string check_daemon_cmd = ssh_command("sudo systemctl is-active docker || echo \"DOCKER_NOT_RUNNING\"");
     
     std::array<char, 128> buffer;
     std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(check_daemon_cmd.c_str(), "r"), pclose);
@@ -224,14 +329,9 @@ std::string UserCredentials::verify_remote_docker_daemon_status() {
 }
 
 bool UserCredentials::start_remote_docker_daemon() {
-    std::cout << "Docker daemon is not running. Starting Docker daemon..." << std::endl; 
+    LEAF_LOG_INFO("Docker daemon is not running. Starting Docker daemon...");
     // First ensure Docker socket directory exists and has correct permissions
-    std::string setup_docker_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        setup_docker_cmd += "-i " + key_path + " ";
-    }
-    setup_docker_cmd += "-p " + std::to_string(port) + " ";
-    setup_docker_cmd += username + "@" + hostname + " '"
+    std::string setup_docker_cmd = ssh_command(
         "sudo mkdir -p /var/run && "
         "sudo chmod 777 /var/run && "
         "sudo mkdir -p /var/run/docker && "
@@ -241,50 +341,69 @@ bool UserCredentials::start_remote_docker_daemon() {
         "sudo service docker start || "
         "(sudo nohup dockerd > /var/log/docker.log 2>&1 &) && "
         "sleep 5 && "  // Wait for daemon to fully start
-        "sudo docker info || echo \"DOCKER_START_FAILED\"'";
+        "sudo docker info || echo \"DOCKER_START_FAILED\"");
     if (std::system(setup_docker_cmd.c_str()) != 0) {
-        std::cerr << "Failed to set up Docker daemon on " << hostname << std::endl;
+        LEAF_LOG_ERROR("Failed to set up Docker daemon on " << hostname);
         return false;
     }
     return true;
 }
 
-bool UserCredentials::copy_docker_files_to_remote_server() {
-    // Create build directory
-    std::string mkdir_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        mkdir_cmd += "-i " + key_path + " ";
+std::string UserCredentials::remote_image_status(const std::string& tag) {
+    std::string image = "leaf-grpc-server:" + tag;
+    std::string status_cmd = ssh_command(
+        "if docker ps --filter name=^leaf-grpc-server$ --format \"{{.Image}}\" | grep -qx " + image + "; then echo RUNNING; "
+        "elif docker image inspect " + image + " >/dev/null 2>&1; then echo IMAGE; "
+        "else echo NONE; fi");
+    
+    std::array<char, 128> buffer;
+    std::string result;
+    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(status_cmd.c_str(), "r"), pclose);
+    if (pipe) {
+        while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
+            result += buffer.data();
+        }
+    }
+    if (result.find("RUNNING") != std::string::npos) {
+        return "RUNNING";
+    }
+    if (result.find("IMAGE") != std::string::npos) {
+        return "IMAGE";
     }
-    mkdir_cmd += "-p " + std::to_string(port) + " ";
-    mkdir_cmd += username + "@" + hostname + " 'rm -rf /tmp/leaf-build && mkdir -p /tmp/leaf-build && chmod 777 /tmp/leaf-build'";
+    return "NONE";
+}
+
+bool UserCredentials::copy_docker_files_to_remote_server(bool script_only) {
+    // Create build directory
+    std::string mkdir_cmd = ssh_command("rm -rf /tmp/leaf-build && mkdir -p /tmp/leaf-build && chmod 777 /tmp/leaf-build");
     if (std::system(mkdir_cmd.c_str()) != 0) {
-        std::cerr << "Failed to create build directory on " << hostname << std::endl;
+        LEAF_LOG_ERROR("Failed to create build directory on " << hostname);
         return false;
     }
-    // Copy Docker files to build directory
-    std::string scp_cmd = "scp -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        scp_cmd += "-i " + key_path + " ";
+    // Copy Docker files to build directory; scp takes the same options, so it rides the master too
+    std::string scp_cmd = "scp " + ssh_options() + "-P " + std::to_string(port) + " ";
+    if (script_only) {
+        // The image is already built; starting a container only needs the run script
+        scp_cmd += "docker-run.sh ";
+    } else {
+        for (const auto& file : server_build_files) {
+            scp_cmd += file + " ";
+        }
     }
-    scp_cmd += "-P " + std::to_string(port) + " ";
-    scp_cmd += "Dockerfile docker-run.sh src/model.h src/model.cpp src/criterion.h src/criterion.cpp src/server_communication.cpp src/server_communication.h src/server_communication.proto " + username + "@" + hostname + ":/tmp/leaf-build/";
+    scp_cmd += username + "@" + hostname + ":/tmp/leaf-build/";
     if (std::system(scp_cmd.c_str()) != 0) {
-        std::cerr << "Failed to copy Docker files to " << hostname << std::endl;
+        LEAF_LOG_ERROR("Failed to copy Docker files to " << hostname);
         return false;
     }
-    std::cout << "Docker files copied successfully" << std::endl;
+    LEAF_LOG_INFO("Docker files copied successfully");
     return true;
 }
 
-bool UserCredentials::build_run_docker_container() {
-    std::string ssh_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        ssh_cmd += "-i " + key_path + " ";
-    }
-    ssh_cmd += "-p " + std::to_string(port) + " ";
-    ssh_cmd += username + "@" + hostname + " 'cd /tmp/leaf-build && chmod +x docker-run.sh && ./docker-run.sh'";        
+bool UserCredentials::build_run_docker_container(const std::string& tag, bool build) {
+    std::string ssh_cmd = ssh_command("cd /tmp/leaf-build && chmod +x docker-run.sh && ./docker-run.sh " + tag +
+                                      (build ? "" : " --skip-build"));
     if (std::system(ssh_cmd.c_str()) != 0) {
-        std::cerr << "Failed to start Docker container on " << hostname << std::endl;
+        LEAF_LOG_ERROR("Failed to start Docker container on " << hostname);
         return false;
     }
 
@@ -292,14 +411,9 @@ bool UserCredentials::build_run_docker_container() {
     std::this_thread::sleep_for(std::chrono::seconds(5));
 
     // Verify container is running
-    ssh_cmd = "ssh -o BatchMode=yes -o ConnectTimeout=10 -o StrictHostKeyChecking=no ";
-    if (!key_path.empty()) {
-        ssh_cmd += "-i " + key_path + " ";
-    }
-    ssh_cmd += "-p " + std::to_string(port) + " ";
-    ssh_cmd += username + "@" + hostname + " 'docker ps | grep leaf-grpc-server'";
+    ssh_cmd = ssh_command("docker ps | grep leaf-grpc-server");
     if (std::system(ssh_cmd.c_str()) != 0) {
-        std::cerr << "Docker container is not running on " << hostname << std::endl;
+        LEAF_LOG_ERROR("Docker container is not running on " << hostname);
         return false;
     }
     return true;
@@ -335,14 +449,14 @@ bool UserCredentials::verify_grpc_connection() {
         if (!verify_ssh_connection()) {
             return false;
         }
-        std::cout << hostname << " : ssh connection successful" << std::endl;
+        LEAF_LOG_INFO(hostname << " : ssh connection successful");
 
         if (!verify_remote_docker_installation()) {
             if (!install_remote_docker()) {
                 return false;
             }
         }
-        std::cout << hostname << " :docker verification successful" << std::endl;
+        LEAF_LOG_INFO(hostname << " :docker verification successful");
 
         std::string result = verify_remote_docker_daemon_status();
         if (result.find("DOCKER_NOT_RUNNING") != std::string::npos || result.find("inactive") != std::string::npos) {
@@ -350,32 +464,45 @@ bool UserCredentials::verify_grpc_connection() {
                 return false;
             }
         }
-        std::cout << hostname << " : docker daemon verification successful" << std::endl;
+        LEAF_LOG_INFO(hostname << " : docker daemon verification successful");
 
-        if (!copy_docker_files_to_remote_server()) {
-            return false;
+        // Images are tagged with a hash of their sources; a host that already has this exact
+        // image skips the copy and build, and one already running it skips the restart too
+        std::string tag = server_image_tag();
+        std::string image_status = tag.empty() ? "NONE" : remote_image_status(tag);
+        if (tag.empty()) {
+            tag = "latest";
         }
-        std::cout << hostname << " : docker files copied successful" << std::endl;
-        
-        if (!build_run_docker_container()) {
-            return false;
+        if (image_status == "RUNNING") {
+            LEAF_LOG_INFO(hostname << " : container for image " << tag << " already running");
+        } else {
+            bool build = image_status != "IMAGE";
+            if (!copy_docker_files_to_remote_server(!build)) {
+                return false;
+            }
+            LEAF_LOG_INFO(hostname << " : docker files copied successful");
+            
+            if (!build_run_docker_container(tag, build)) {
+                return false;
+            }
+            LEAF_LOG_INFO(hostname << " : docker container " << (build ? "built" : "started from cached image " + tag)
+                          << " successful");
         }
-        std::cout << hostname << " : docker container built successful" << std::endl;
         
         if (!setup_ssh_tunnel()) {
             return false;
         }
-        std::cout << hostname << " : ssh tunnel setup successful" << std::endl;
+        LEAF_LOG_INFO(hostname << " : ssh tunnel setup successful");
         
         if (!test_grpc_connection()) {
             return false;
         }
-        std::cout << hostname << " : grpc connection successful" << std::endl;
+        LEAF_LOG_INFO(hostname << " : grpc connection successful");
 
         return true;
 
     } catch (const std::exception& e) {
-        std::cerr << "Error verifying gRPC connection: " << e.what() << std::endl;
+        LEAF_LOG_ERROR("Error verifying gRPC connection: " << e.what());
         return false;
     } 
 }
@@ -384,13 +511,17 @@ bool UserCredentials::verify_grpc_connection() {
 UserCredentials::UserCredentials(const std::string& user, const std::string& host, 
                                int p, const std::string& key)
     : username(user), hostname(host), port(p), key_path(key), is_connected(false), 
-      tunnel_pid(0), tunnel_port(0), tunnel_ref_count(std::make_shared<int>(1)) {}
+      tunnel_pid(0), tunnel_port(0), tunnel_ref_count(std::make_shared<int>(1)),
+      // %C hashes the local host, remote host, port and user, keeping the socket path short
+      // enough for sun_path; the pid keeps processes from closing each other's masters
+      control_path("/tmp/leaf-ssh-" + std::to_string(getpid()) + "-%C"), control_master_open(false) {}
 
 // Copy constructor
 UserCredentials::UserCredentials(const UserCredentials& other)
     : username(other.username), hostname(other.hostname), port(other.port), 
       key_path(other.key_path), is_connected(other.is_connected), 
-      tunnel_pid(other.tunnel_pid), tunnel_port(other.tunnel_port), tunnel_ref_count(other.tunnel_ref_count) {
+      tunnel_pid(other.tunnel_pid), tunnel_port(other.tunnel_port), tunnel_ref_count(other.tunnel_ref_count),
+      control_path(other.control_path), control_master_open(other.control_master_open) {
     // Increment reference count
     if (tunnel_ref_count) {
         (*tunnel_ref_count)++;
@@ -413,6 +544,8 @@ UserCredentials& UserCredentials::operator=(const UserCredentials& other) {
         tunnel_pid = other.tunnel_pid;
         tunnel_port = other.tunnel_port;
         tunnel_ref_count = other.tunnel_ref_count;
+        control_path = other.control_path;
+        control_master_open = other.control_master_open;
         
         // Increment new reference count
         if (tunnel_ref_count) {
@@ -430,12 +563,18 @@ UserCredentials::~UserCredentials() {
         if (*tunnel_ref_count == 0 && (tunnel_pid > 0 || tunnel_port > 0)) {
             cleanup_ssh_tunnel();
         }
+        if (*tunnel_ref_count == 0) {
+            close_control_master();
+        }
     }
 }
 
 bool UserCredentials::verify_connection() {
     is_connected = verify_grpc_connection();
-    std::cout << "gRPC verification " << (is_connected ? "successful" : "failed") << std::endl;
+    if (!is_connected) {
+        close_control_master();
+    }
+    LEAF_LOG_INFO("gRPC verification " << (is_connected ? "successful" : "failed"));
     return is_connected;
 }
 
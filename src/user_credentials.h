@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <thread>
 #include <chrono>
+#include <vector>
 #include <grpc/grpc.h>
 #include <grpcpp/grpcpp.h>
 #include "server_communication.pb.h"
@@ -24,7 +25,9 @@ private:
     bool is_connected;
     int tunnel_pid;  // PID of SSH tunnel process
     int tunnel_port; // Local port for SSH tunnel
-    std::shared_ptr<int> tunnel_ref_count; // Reference count for tunnel ownership
+    std::shared_ptr<int> tunnel_ref_count; // Reference count for tunnel and control master ownership
+    std::string control_path; // Socket of the multiplexed SSH master shared by all commands to this host
+    bool control_master_open;
 
     // Static member to track used ports
     static std::set<int> used_ports;
@@ -34,13 +37,17 @@ private:
     void release_port();
     bool setup_ssh_tunnel();
     void cleanup_ssh_tunnel();
+    std::string ssh_options(const std::string& control_master = "no") const;
+    bool start_control_master();
+    void close_control_master();
     bool verify_ssh_connection();
     bool verify_remote_docker_installation();
     bool install_remote_docker();
     std::string verify_remote_docker_daemon_status();
     bool start_remote_docker_daemon();
-    bool copy_docker_files_to_remote_server();
-    bool build_run_docker_container();
+    std::string remote_image_status(const std::string& tag);
+    bool copy_docker_files_to_remote_server(bool script_only = false);
+    bool build_run_docker_container(const std::string& tag, bool build = true);
     bool test_grpc_connection();
     bool verify_grpc_connection();
 
@@ -58,6 +65,14 @@ public:
     ~UserCredentials();
 
     bool verify_connection();
+
+    // Shell command running remote_command on the host over the shared SSH connection; the
+    // command is single-quoted, so it must not contain single quotes itself
+    std::string ssh_command(const std::string& remote_command) const;
+
+    // Image tag derived from the contents of the server sources and Dockerfile, so a host that
+    // already has the image (or a container running it) can skip the copy and build
+    static std::string server_image_tag();
     std::string get_connection_string() const;
     bool get_connection_status() const { return is_connected; }
     std::string get_username() const { return username; }